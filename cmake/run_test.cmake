@@ -42,6 +42,7 @@ cmake_minimum_required (VERSION 2.8.11)
 
 if(NOT TEST_EXE)
   message(FATAL_ERROR "  Usage: cmake -DTEST_EXE=<executable> [-DTEST_INPUT=<input-file>] \\\n"
+                      "               [-DTEST_ARGS=<command-line-arguments>] \\\n"
                       "               [-DTEST_GOLDEN=<reference-output-file>] \\\n"
                       "               [-DTEST_FILTER=<pattern-to-filter-from-log>] \\\n"
                       "               [-DDIFF_COMMAND=<diff-command>] \\\n"
@@ -70,14 +71,14 @@ if(TEST_GOLDEN AND NOT EXISTS ${TEST_GOLDEN})
 endif(TEST_GOLDEN AND NOT EXISTS ${TEST_GOLDEN})
 
 if(TEST_INPUT)
-  execute_process(COMMAND ${TEST_EXE}
+  execute_process(COMMAND ${TEST_EXE} ${TEST_ARGS}
                   WORKING_DIRECTORY ${TEST_DIR}
                   RESULT_VARIABLE TEST_EXIT_CODE
                   INPUT_FILE ${TEST_INPUT}
                   OUTPUT_FILE run.log
                   ERROR_VARIABLE TEST_ERROR)
 else(TEST_INPUT)
-  execute_process(COMMAND ${TEST_EXE}
+  execute_process(COMMAND ${TEST_EXE} ${TEST_ARGS}
                   WORKING_DIRECTORY ${TEST_DIR}
                   RESULT_VARIABLE TEST_EXIT_CODE
                   OUTPUT_FILE run.log
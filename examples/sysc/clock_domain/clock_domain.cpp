@@ -0,0 +1,190 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  clock_domain.cpp -- Clocks in a domain observe the same edges as
+                      independent clocks.
+
+                      Two pairs of clocks with co-prime periods are observed
+                      by identical sets of processes: the first pair is
+                      generated by a clock domain, the second one by the
+                      clocks themselves.  Both sets of samples, including
+                      the delta cycle of each edge, must be identical.
+
+                      A second domain would need more than 65536 edges per
+                      hyperperiod: it is not scheduled and its clocks run
+                      separately (warning 131).  Adding a clock to a second
+                      domain or after elaboration is rejected (error 130).
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+SC_MODULE(observer)
+{
+    sc_in<bool> fast;
+    sc_in<bool> slow;
+
+    SC_CTOR(observer)
+      : fast("fast"), slow("slow")
+    {
+        SC_METHOD(sample);
+        sensitive << fast << slow;
+        dont_initialize();
+        SC_THREAD(edges);
+    }
+
+    void sample()
+    {
+        std::stringstream ss;
+        ss << sc_time_stamp() << " delta "
+           << sc_delta_count_at_current_time() << ": fast"
+           << ( fast.event() ? "* " : "  " ) << fast.read() << ", slow"
+           << ( slow.event() ? "* " : "  " ) << slow.read();
+        m_samples.push_back( ss.str() );
+    }
+
+    // waits for edges of either clock and for both edges at once
+    void edges()
+    {
+        for( int i = 0; i < 4; ++i ) {
+            wait( fast->posedge_event() | slow->negedge_event() );
+            log( "posedge fast | negedge slow" );
+        }
+        wait( fast->posedge_event() & slow->posedge_event() );
+        log( "posedge fast & posedge slow" );
+    }
+
+    void log( const char* what )
+    {
+        std::stringstream ss;
+        ss << sc_time_stamp() << ": " << what;
+        m_samples.push_back( ss.str() );
+    }
+
+    std::vector<std::string> m_samples;
+};
+
+// tries to add a clock during the simulation
+SC_MODULE(late)
+{
+    sc_clock_domain* domain_p;
+    sc_clock*        clock_p;
+
+    SC_CTOR(late)
+      : domain_p( 0 ), clock_p( 0 )
+    {
+        SC_THREAD(run);
+    }
+
+    void run()
+    {
+        wait( 10, SC_NS );
+        try {
+            domain_p->add( *clock_p );
+        }
+        catch( const sc_report& rep ) {
+            cout << sc_time_stamp() << ": " << rep.get_msg() << endl;
+        }
+    }
+};
+
+static void compare( const observer& d, const observer& i )
+{
+    const std::vector<std::string>& l = d.m_samples;
+    const std::vector<std::string>& r = i.m_samples;
+    for( std::size_t k = 0; k < l.size(); ++k ) {
+        cout << l[k];
+        if( k >= r.size() || l[k] != r[k] )
+            cout << "  MISMATCH: independent clocks "
+                 << ( k < r.size() ? r[k] : "(missing)" );
+        cout << endl;
+    }
+    cout << l.size() << " samples of the domain, "
+         << r.size() << " samples of the independent clocks" << endl;
+}
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_actions( SC_ID_CLOCK_DOMAIN_TOO_LARGE_,
+                                    SC_DO_NOTHING );
+
+    // co-prime periods, hyperperiod 77 ns
+    sc_clock fast_clk ( "fast_clk",  7, SC_NS, 0.5,  0, SC_NS );
+    sc_clock slow_clk ( "slow_clk", 11, SC_NS, 0.3,  2, SC_NS, false );
+    sc_clock fast_ref ( "fast_ref",  7, SC_NS, 0.5,  0, SC_NS );
+    sc_clock slow_ref ( "slow_ref", 11, SC_NS, 0.3,  2, SC_NS, false );
+    sc_clock_domain domain( "domain" );
+    domain.add( fast_clk );
+    domain.add( slow_clk );
+
+    // co-prime periods of about 40 ns, some 160000 edges per hyperperiod
+    sc_clock large_fast( "large_fast", 40009, SC_PS );
+    sc_clock large_slow( "large_slow", 40013, SC_PS );
+    sc_clock large_fast_ref( "large_fast_ref", 40009, SC_PS );
+    sc_clock large_slow_ref( "large_slow_ref", 40013, SC_PS );
+    sc_clock_domain large( "large" );
+    large.add( large_fast );
+    large.add( large_slow );
+
+    try {
+        large.add( fast_clk );
+    }
+    catch( const sc_report& rep ) {
+        cout << "elaboration: " << rep.get_msg() << endl;
+    }
+
+    observer in_domain( "in_domain" );
+    observer independent( "independent" );
+    observer in_large( "in_large" );
+    observer large_independent( "large_independent" );
+    in_domain.fast( fast_clk );
+    in_domain.slow( slow_clk );
+    independent.fast( fast_ref );
+    independent.slow( slow_ref );
+    in_large.fast( large_fast );
+    in_large.slow( large_slow );
+    large_independent.fast( large_fast_ref );
+    large_independent.slow( large_slow_ref );
+
+    sc_clock extra( "extra", 5, SC_NS );
+    late l( "late" );
+    l.domain_p = &domain;
+    l.clock_p  = &extra;
+
+    sc_start( 200, SC_NS );
+
+    cout << domain.name() << ": "
+         << ( domain.is_scheduled() ? "scheduled" : "not scheduled" )
+         << ", hyperperiod " << domain.hyperperiod() << endl;
+    compare( in_domain, independent );
+
+    cout << large.name() << ": "
+         << ( large.is_scheduled() ? "scheduled" : "not scheduled" )
+         << ", hyperperiod " << large.hyperperiod() << ", "
+         << sc_report_handler::get_count( SC_ID_CLOCK_DOMAIN_TOO_LARGE_ )
+         << " warning" << endl;
+    compare( in_large, large_independent );
+    return 0;
+}
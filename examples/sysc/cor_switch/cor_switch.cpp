@@ -0,0 +1,98 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  cor_switch.cpp -- Micro-benchmark of the thread process context switch.
+
+                    Two thread processes pass a token back and forth via
+                    a pair of events, so that every delta cycle consists
+                    of exactly one context switch into a thread process
+                    and one back to the simulator.
+
+                    The number of round trips can be given on the command
+                    line (default: 1000000).  The example prints the
+                    processor time per context switch, which allows to
+                    compare the coroutine packages (e.g., the futex and
+                    the condition variable handoff of the pthreads
+                    package, see SC_COR_PTHREAD_HANDOFF).  Only the
+                    lines ending in a count are independent of the host,
+                    the regression test compares those.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdlib>
+#include <ctime>
+
+SC_MODULE(ping_pong)
+{
+    SC_CTOR(ping_pong)
+      : rounds(0)
+    {
+        SC_THREAD(ping);
+        SC_THREAD(pong);
+    }
+
+    void ping()
+    {
+        for( unsigned long i = 0; i < rounds; ++i )
+        {
+            ping_ev.notify(SC_ZERO_TIME);
+            wait(pong_ev);
+        }
+    }
+
+    void pong()
+    {
+        for(;;)
+        {
+            wait(ping_ev);
+            pong_ev.notify(SC_ZERO_TIME);
+        }
+    }
+
+    unsigned long rounds;
+    sc_event      ping_ev;
+    sc_event      pong_ev;
+};
+
+int sc_main(int argc, char* argv[])
+{
+    unsigned long rounds = 1000000;
+    if( argc > 1 )
+        rounds = std::strtoul(argv[1], 0, 10);
+
+    ping_pong top("top");
+    top.rounds = rounds;
+
+    std::clock_t start = std::clock();
+    sc_start();
+    std::clock_t stop = std::clock();
+
+    double seconds  = double(stop - start) / CLOCKS_PER_SEC;
+    double switches = 2.0 * rounds + 1;
+
+    cout << "round trips:    " << rounds << endl;
+    cout << "delta cycles:   " << sc_delta_count() << endl;
+    cout << "total time:     " << seconds << " s" << endl;
+    cout << "per switch:     " << seconds / switches * 1e9 << " ns" << endl;
+    return 0;
+}
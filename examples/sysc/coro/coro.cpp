@@ -0,0 +1,111 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  coro.cpp -- Stackless coroutine processes (SC_CORO).
+
+              A producer coroutine writes a signal every 10 ns via
+              co_wait(time), a consumer coroutine follows the signal via
+              co_wait(event), and a watchdog coroutine waits for the
+              signal with a timeout via co_wait(time, event).  All of
+              them return after a few rounds, which terminates their
+              processes.
+
+              Coroutine processes require SystemC and the model to be
+              compiled with C++20, hence this example is only built by
+              CMake with CMAKE_CXX_STANDARD set to 20 or later.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#if !defined(SC_HAS_COROUTINES_)
+# error "SC_CORO requires a C++20 compiler with coroutine support"
+#endif
+
+SC_MODULE(coro)
+{
+    sc_signal<int> data;
+
+    SC_CTOR(coro)
+      : data("data")
+    {
+        SC_CORO(producer);
+        SC_CORO(consumer);
+        SC_CORO(watchdog);
+    }
+
+    sc_coro producer()
+    {
+        for( int i = 1; i <= 5; ++i ) {
+            co_await co_wait( 10, SC_NS );
+            data.write( i );
+        }
+        cout << sc_time_stamp() << ": producer done" << endl;
+    }
+
+    sc_coro consumer()
+    {
+        int sum = 0;
+        while( sum < 15 ) {
+            co_await co_wait( data.value_changed_event() );
+            sum += data.read();
+            cout << sc_time_stamp() << ": consumer read " << data.read()
+                 << ", sum " << sum << endl;
+        }
+        cout << sc_time_stamp() << ": consumer done" << endl;
+    }
+
+    sc_coro watchdog()
+    {
+        int changes = 0;
+        for( ;; ) {
+            co_await co_wait( 25, SC_NS, data.value_changed_event() );
+            if( !data.value_changed_event().triggered() ) {
+                break;
+            }
+            ++changes;
+        }
+        cout << sc_time_stamp() << ": watchdog timed out after " << changes
+             << " changes" << endl;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    coro top( "top" );
+
+    // keep handles, a terminated process is deleted once unreferenced
+    const char* names[] = { "top.producer", "top.consumer", "top.watchdog" };
+    sc_process_handle h[3];
+    for( int i = 0; i < 3; ++i ) {
+        h[i] = sc_process_handle( sc_find_object( names[i] ) );
+    }
+
+    sc_start();
+
+    for( int i = 0; i < 3; ++i ) {
+        cout << h[i].name()
+             << ( h[i].terminated() ? " terminated" : " alive" ) << endl;
+    }
+    cout << sc_time_stamp() << ": " << sc_pending_activity() << " pending"
+         << endl;
+    return 0;
+}
@@ -0,0 +1,252 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  direct_ports.cpp -- Direct access of signal ports to their channels
+                      (SC_DIRECT_PORTS=ON).
+
+                      The same design is simulated in a new simulation
+                      context without and with SC_DIRECT_PORTS=ON.  Its
+                      ports are bound to
+
+                      - plain signals and buffers, which are read and
+                        written directly if enabled, including the writer
+                        policy checks of the channels,
+                      - a clock, a resolved signal and a signal derived
+                        from sc_signal, which are always accessed via their
+                        interface.
+
+                      Both simulations must log the same values, events and
+                      errors.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+static std::ostringstream* log_p = 0;
+
+// counts the calls of its interface methods
+class counting_signal : public sc_signal<int>
+{
+public:
+    explicit counting_signal( const char* name_ )
+      : sc_signal<int>( name_ ), reads( 0 ), writes( 0 )
+    {}
+
+    virtual const int& read() const
+        { ++reads; return sc_signal<int>::read(); }
+
+    virtual void write( const int& value_ )
+        { ++writes; sc_signal<int>::write( value_ ); }
+
+    mutable int reads;
+    int         writes;
+};
+
+SC_MODULE(top)
+{
+    sc_in<bool>       clk;
+    sc_inout<int>     one;      // sc_signal<int>, one writer
+    sc_out<int>       many_a;   // sc_signal<int,SC_MANY_WRITERS>
+    sc_out<int>       many_b;
+    sc_in<int>        many_in;
+    sc_out<int>       buf;      // sc_buffer<int>
+    sc_out<int>       counted;  // counting_signal
+    sc_in<int>        counted_in;
+    sc_out<bool>      flag;     // sc_signal<bool>
+    sc_in<bool>       flag_in;
+    sc_out<sc_logic>  logic;    // sc_signal<sc_logic>
+    sc_inout<sc_logic> res_a;   // sc_signal_resolved
+    sc_inout<sc_logic> res_b;
+
+    int buffer_events;
+
+    SC_CTOR(top)
+      : clk("clk"), one("one"), many_a("many_a"), many_b("many_b")
+      , many_in("many_in"), buf("buf"), counted("counted")
+      , counted_in("counted_in"), flag("flag"), flag_in("flag_in")
+      , logic("logic"), res_a("res_a"), res_b("res_b"), buffer_events( 0 )
+    {
+        logic.initialize( SC_LOGIC_1 );
+
+        SC_THREAD(writer);
+        SC_THREAD(intruder);
+        SC_METHOD(monitor);
+        sensitive << one << many_in << counted_in << flag_in << logic
+                  << res_a << res_b;
+        dont_initialize();
+        SC_METHOD(buffer_written);
+        sensitive << buf;
+        dont_initialize();
+    }
+
+    void writer()
+    {
+        for( int i = 1; i <= 3; ++i ) {
+            wait( clk.posedge_event() );
+            one.write( i );
+            many_a.write( 10 * i );
+            buf.write( 5 );
+            counted.write( counted_in.read() + i );
+            flag.write( !flag_in.read() );
+            logic.write( flag_in.read() ? SC_LOGIC_1 : SC_LOGIC_0 );
+            res_a.write( i == 2 ? SC_LOGIC_Z : SC_LOGIC_0 );
+        }
+    }
+
+    // a second writer of the signals
+    void intruder()
+    {
+        wait( clk.posedge_event() );
+        res_b.write( SC_LOGIC_1 );
+        wait( clk.posedge_event() );
+        try {
+            many_b.write( 20 );
+        }
+        catch( const sc_report& rep ) {
+            *log_p << sc_time_stamp() << ": " << rep.get_msg() << "\n";
+        }
+        wait( clk.negedge_event() );
+        many_b.write( 25 );
+        try {
+            one.write( 0 );
+        }
+        catch( const sc_report& rep ) {
+            *log_p << sc_time_stamp() << ": " << rep.get_msg() << "\n";
+        }
+    }
+
+    void monitor()
+    {
+        *log_p << sc_time_stamp() << ": clk " << clk.read()
+               << ", one " << one.read() << ", many " << many_in.read()
+               << ", buf " << buf.read() << ", counted " << counted_in.read()
+               << ", flag " << flag_in.read() << ", logic " << logic.read()
+               << ", resolved " << res_a.read() << "\n";
+    }
+
+    void buffer_written()
+    {
+        ++buffer_events;
+    }
+};
+
+// which of the channels the ports access directly
+template< class T >
+static void print_access( const char* name, sc_interface& channel )
+{
+    cout << " " << name << ( sc_core::sc_signal_direct<T>::value( &channel )
+                             ? " direct" : " via interface" );
+}
+
+static void set_direct_ports( const char* value )
+{
+#if defined(_WIN32)
+    // an empty value removes the variable
+    static std::string setting;
+    setting = std::string( "SC_DIRECT_PORTS=" ) + ( value ? value : "" );
+    _putenv( setting.c_str() );
+#else
+    if( value )
+        setenv( "SC_DIRECT_PORTS", value, 1 );
+    else
+        unsetenv( "SC_DIRECT_PORTS" );
+#endif
+}
+
+static std::string simulate( const char* direct_ports )
+{
+    set_direct_ports( direct_ports );
+    cout << "SC_DIRECT_PORTS=" << ( direct_ports ? direct_ports : "" )
+         << endl;
+
+    sc_simcontext* context = new sc_simcontext;
+    sc_set_curr_simcontext( context );
+
+    std::ostringstream log;
+    log_p = &log;
+    {
+        sc_clock                        clk( "clk", 10, SC_NS );
+        sc_signal<int>                  one( "one" );
+        sc_signal<int,SC_MANY_WRITERS>  many( "many" );
+        sc_buffer<int>                  buf( "buf" );
+        counting_signal                 counted( "counted" );
+        sc_signal<bool>                 flag( "flag" );
+        sc_signal<sc_logic>             logic( "logic" );
+        sc_signal_resolved              res( "res" );
+
+        top t( "top" );
+        t.clk( clk );
+        t.one( one );
+        t.many_a( many );
+        t.many_b( many );
+        t.many_in( many );
+        t.buf( buf );
+        t.counted( counted );
+        t.counted_in( counted );
+        t.flag( flag );
+        t.flag_in( flag );
+        t.logic( logic );
+        t.res_a( res );
+        t.res_b( res );
+
+        sc_start( 40, SC_NS );
+
+        cout << " ";
+        print_access<int>( "one", one );
+        print_access<int>( "many", many );
+        print_access<int>( "buf", buf );
+        print_access<bool>( "flag", flag );
+        print_access<sc_logic>( "logic", logic );
+        cout << endl << " ";
+        print_access<bool>( "clk", clk );
+        print_access<int>( "counted", counted );
+        print_access<sc_logic>( "res", res );
+        cout << endl;
+
+        log << "buffer events " << t.buffer_events
+            << ", counted reads " << counted.reads
+            << ", counted writes " << counted.writes << "\n";
+    }
+    log_p = 0;
+
+    sc_set_curr_simcontext( 0 );
+    delete context;
+    return log.str();
+}
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_actions( SC_ID_MORE_THAN_ONE_SIGNAL_DRIVER_,
+                                    SC_THROW );
+
+    const std::string indirect = simulate( 0 );
+    const std::string direct   = simulate( "ON" );
+    cout << indirect;
+    if( direct == indirect )
+        cout << "same log with SC_DIRECT_PORTS=ON" << endl;
+    else
+        cout << "different log with SC_DIRECT_PORTS=ON:" << endl << direct;
+    return 0;
+}
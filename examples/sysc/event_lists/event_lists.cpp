@@ -0,0 +1,228 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  event_lists.cpp -- Temporary event lists of wait() and next_trigger().
+
+                     The driver notifies event k in every (k+1)-th step.
+                     Threads wait on OR and AND expressions of two events,
+                     which fit into the list, and of five events, which do
+                     not.  A method alternates between such expressions in
+                     next_trigger(), and another thread waits on a list
+                     kept in a member.  Each process takes the list of its
+                     previous expression for the next one of the same kind.
+
+                     Other processes are killed or reset while they wait
+                     on a temporary list.  They must not be woken up by
+                     the events of the list afterwards.
+
+                     In the steady state, the waits must not allocate any
+                     memory.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdlib>
+#include <new>
+
+static const int events = 6;
+static const int steps  = 300;
+
+// allocations while counting
+static bool     counting    = false;
+static unsigned allocations = 0;
+
+#if __cplusplus >= 201103L
+void* operator new( std::size_t size )
+#else
+void* operator new( std::size_t size ) throw( std::bad_alloc )
+#endif
+{
+    if( counting )
+        ++allocations;
+    void* p = std::malloc( size ? size : 1 );
+    if( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* p ) throw()
+{
+    std::free( p );
+}
+
+SC_MODULE(top)
+{
+    sc_event          e[events];
+    sc_event_or_list  m_list;
+    sc_process_handle m_killed, m_reset, m_method;
+    int               m_or, m_and, m_timed, m_timeouts, m_member;
+    int               m_triggers, m_killed_wakeups, m_reset_wakeups;
+    int               m_method_triggers;
+
+    SC_CTOR(top)
+      : m_or( 0 ), m_and( 0 ), m_timed( 0 ), m_timeouts( 0 ), m_member( 0 )
+      , m_triggers( 0 ), m_killed_wakeups( 0 ), m_reset_wakeups( 0 )
+      , m_method_triggers( 0 )
+    {
+        m_list = e[3] | e[5];
+
+        SC_THREAD(driver);
+        SC_THREAD(or_waiter);
+        SC_THREAD(and_waiter);
+        SC_THREAD(timed_waiter);
+        SC_THREAD(member_waiter);
+        SC_METHOD(alternating);
+        SC_THREAD(killed);
+        m_killed = sc_get_current_process_handle();
+        SC_THREAD(reset);
+        m_reset = sc_get_current_process_handle();
+        SC_METHOD(method);
+        m_method = sc_get_current_process_handle();
+    }
+
+    void driver()
+    {
+        for( int s = 1; s <= steps; ++s ) {
+            wait( 1, SC_NS );
+            if( s == 50 || s == 150 ) {
+                log( "resetting top.reset" );
+                m_reset.reset();
+            }
+            if( s == 100 ) {
+                log( "killing top.killed" );
+                m_killed.kill();
+            }
+            if( s == 120 ) {
+                log( "killing top.method" );
+                m_method.kill();
+            }
+            if( s == 200 )
+                counting = true;
+            for( int k = 0; k < events; ++k ) {
+                if( s % ( k + 1 ) == 0 )
+                    e[k].notify( SC_ZERO_TIME );
+            }
+        }
+        counting = false;
+    }
+
+    static void log( const char* what )
+    {
+        cout << sc_time_stamp() << ": " << what << endl;
+    }
+
+    void or_waiter()
+    {
+        for( ;; ) {
+            wait( e[1] | e[2] );
+            ++m_or;
+            wait( e[1] | e[2] | e[3] | e[4] | e[5] );
+            ++m_or;
+        }
+    }
+
+    void and_waiter()
+    {
+        for( ;; ) {
+            wait( e[1] & e[2] );
+            ++m_and;
+            wait( e[1] & e[2] & e[3] & e[4] & e[5] );
+            ++m_and;
+        }
+    }
+
+    void timed_waiter()
+    {
+        for( ;; ) {
+            wait( sc_time( 3.5, SC_NS ), e[4] | e[5] );
+            if( e[4].triggered() || e[5].triggered() )
+                ++m_timed;
+            else
+                ++m_timeouts;
+        }
+    }
+
+    void member_waiter()
+    {
+        for( ;; ) {
+            wait( m_list );
+            ++m_member;
+        }
+    }
+
+    void alternating()
+    {
+        if( m_triggers++ % 2 )
+            next_trigger( e[1] & e[2] );
+        else
+            next_trigger( e[0] | e[2] | e[3] | e[4] | e[5] );
+    }
+
+    void killed()
+    {
+        for( ;; ) {
+            wait( e[3] & e[4] );
+            ++m_killed_wakeups;
+        }
+    }
+
+    void reset()
+    {
+        log( "top.reset started" );
+        for( ;; ) {
+            wait( e[4] | e[5] );
+            ++m_reset_wakeups;
+        }
+    }
+
+    void method()
+    {
+        if( m_method_triggers++ )
+            next_trigger( e[0] & e[5] );
+        else
+            next_trigger( e[2] | e[5] );
+    }
+
+    void report() const
+    {
+        cout << "or_waiter:     " << m_or << " wakeups" << endl
+             << "and_waiter:    " << m_and << " wakeups" << endl
+             << "timed_waiter:  " << m_timed << " wakeups, "
+             << m_timeouts << " timeouts" << endl
+             << "member_waiter: " << m_member << " wakeups" << endl
+             << "alternating:   " << m_triggers << " triggers" << endl
+             << "killed:        " << m_killed_wakeups << " wakeups" << endl
+             << "reset:         " << m_reset_wakeups << " wakeups" << endl
+             << "method:        " << m_method_triggers << " triggers"
+             << endl;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    top t( "top" );
+    sc_start( steps + 1, SC_NS );
+    t.report();
+    cout << "allocations in the last " << steps - 200 << " steps: "
+         << allocations << endl;
+    return 0;
+}
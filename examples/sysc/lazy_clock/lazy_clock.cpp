@@ -0,0 +1,132 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  lazy_clock.cpp -- Lazy and eager clocks observe the same values.
+
+                    Two identical clocks are observed by identical sets of
+                    processes: the first clock is lazy, i.e., its edges are
+                    suspended while only threads skipping edges in wait(n)
+                    are sensitive to it, the second one generates all of
+                    its edges.  The processes sample the value and event()
+                    of their clock after wait(n), at arbitrary times, and
+                    upon dynamic sensitivity to its edges.  Both sets of
+                    samples must be identical.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+SC_MODULE(observer)
+{
+    sc_in<bool> clk;
+
+    SC_CTOR(observer)
+      : clk("clk"), m_triggers(0)
+    {
+        SC_CTHREAD(cycles, clk.pos());
+        SC_THREAD(sampler);
+        SC_METHOD(watcher);
+        sensitive << m_watch; // started by the sampler
+        dont_initialize();
+    }
+
+    void log( const char* who )
+    {
+        std::stringstream ss;
+        ss << sc_time_stamp() << ": " << who
+           << " value " << clk->read() << " event " << clk->event();
+        m_samples.push_back( ss.str() );
+    }
+
+    // skips clock edges in wait(n)
+    void cycles()
+    {
+        for( int i = 0; i < 6; ++i ) {
+            wait( 3 * i + 2 );
+            log( "cycles " );
+        }
+    }
+
+    // samples at times unrelated to the clock, then waits for edges
+    void sampler()
+    {
+        static const double at[] = { 0, 3, 13, 100, 101.5, 250, 253, 600 };
+        for( unsigned i = 0; i < sizeof(at) / sizeof(at[0]); ++i ) {
+            wait( sc_time( at[i], SC_NS ) - sc_time_stamp() );
+            log( "sampler" );
+            if( i % 3 == 2 ) {
+                wait( clk->negedge_event() );
+                log( "sampler" );
+            }
+        }
+        m_watch.notify( SC_ZERO_TIME );
+    }
+
+    // timed wake-ups alternating with dynamic sensitivity to value changes
+    void watcher()
+    {
+        log( "watcher" );
+        if( ++m_triggers > 12 )
+            return;
+        if( m_triggers % 4 == 0 )
+            next_trigger( clk->value_changed_event() );
+        else
+            next_trigger( 37, SC_NS );
+    }
+
+    std::vector<std::string> m_samples;
+
+private:
+    int      m_triggers;
+    sc_event m_watch;
+};
+
+int sc_main( int, char*[] )
+{
+    sc_clock lazy_clk ( "lazy_clk",  10, SC_NS, 0.3, 3, SC_NS, false );
+    sc_clock eager_clk( "eager_clk", 10, SC_NS, 0.3, 3, SC_NS, false );
+    lazy_clk.set_lazy( true );
+    eager_clk.set_lazy( false );
+
+    observer lazy ( "lazy" );
+    observer eager( "eager" );
+    lazy.clk( lazy_clk );
+    eager.clk( eager_clk );
+
+    sc_start( 1, SC_US );
+
+    const std::vector<std::string>& l = lazy.m_samples;
+    const std::vector<std::string>& e = eager.m_samples;
+    for( std::size_t i = 0; i < l.size(); ++i ) {
+        cout << l[i];
+        if( i >= e.size() || l[i] != e[i] )
+            cout << "  MISMATCH: eager clock "
+                 << ( i < e.size() ? e[i] : "(missing)" );
+        cout << endl;
+    }
+    cout << l.size() << " samples of the lazy clock, "
+         << e.size() << " samples of the eager clock" << endl;
+    return 0;
+}
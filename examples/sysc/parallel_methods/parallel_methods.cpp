@@ -0,0 +1,163 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  parallel_methods.cpp -- Parallel and sequential evaluation of the same
+                          method processes.
+
+                          Two identical pipelines of method processes write
+                          sc_signals and issue reports on each clock edge.
+                          The stages of the first pipeline are parallel-safe
+                          and evaluated on several host threads, those of the
+                          second one sequentially.  Both must observe the
+                          same values and issue the same reports in the same
+                          order, with the reporting stage as current process.
+                          A rejected event notification of a parallel-safe
+                          stage is reported as an error.
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const char* const stage_id = "/parallel_methods/stage";
+
+SC_MODULE(pipeline)
+{
+    static const int stages = 8;
+
+    sc_in<bool> clk;
+
+    SC_HAS_PROCESS(pipeline);
+    pipeline( sc_module_name, bool parallel )
+      : clk("clk"), m_count("counter"), m_cycles(0), m_parallel(parallel)
+    {
+        SC_METHOD(count);
+        sensitive << clk.pos();
+        dont_initialize();
+
+        for( int i = 0; i < stages; ++i ) {
+            std::stringstream ss;
+            ss << "stage_" << i;
+            sc_spawn_options opts;
+            opts.spawn_method();
+            opts.set_sensitivity( &clk.pos() );
+            opts.dont_initialize();
+            if( parallel )
+                opts.set_parallel_safe();
+            sc_spawn( sc_bind( &pipeline::stage, this, i ),
+                      ss.str().c_str(), &opts );
+        }
+    }
+
+    void count()
+    {
+        m_count.write( m_count.read() + 1 );
+    }
+
+    // reads the previous stage, reports some of the values
+    void stage( int i )
+    {
+        int v = ( i == 0 ) ? m_count.read() : m_stage[i - 1].read();
+        m_stage[i].write( ( v * 7 + i ) % 1009 );
+
+        if( ( v + i ) % 5 == 0 ) {
+            std::stringstream ss;
+            ss << "read " << v;
+            SC_REPORT_INFO( stage_id, ss.str().c_str() );
+        }
+        if( i == 5 && ++m_cycles == 20 && m_parallel )
+            m_event.notify(); // rejected
+    }
+
+    sc_signal<int> m_stage[stages];
+
+private:
+    sc_signal<int> m_count;
+    int            m_cycles;
+    bool           m_parallel;
+    sc_event       m_event;
+};
+
+// reports by pipeline, "<time> <stage>: <message>"
+static std::vector<std::string> reports[2];
+static std::vector<std::string> errors;
+
+static void record( const sc_report& rep, const sc_actions& actions )
+{
+    if( std::strcmp( rep.get_msg_type(), stage_id ) != 0 &&
+        std::strcmp( rep.get_msg_type(), SC_ID_PARALLEL_SAFE_VIOLATION_ ) )
+    {
+        sc_report_handler::default_handler( rep, actions );
+        return;
+    }
+    sc_process_b* proc_p = sc_get_current_process_b();
+    std::stringstream ss;
+    ss << rep.get_time() << " " << proc_p->basename() << ": "
+       << rep.get_msg();
+    if( rep.get_severity() != SC_INFO ) {
+        ss << " (" << proc_p->name() << ")";
+        errors.push_back( ss.str() );
+    } else {
+        std::string name = proc_p->get_parent_object()->basename();
+        reports[ name == "par" ? 0 : 1 ].push_back( ss.str() );
+    }
+}
+
+int sc_main( int, char*[] )
+{
+    sc_set_parallel_evaluation( 4 );
+    sc_report_handler::set_handler( record );
+
+    sc_clock clk( "clk", 10, SC_NS );
+    pipeline par( "par", true );
+    pipeline seq( "seq", false );
+    par.clk( clk );
+    seq.clk( clk );
+
+    sc_start( 300, SC_NS );
+
+    const std::vector<std::string>& p = reports[0];
+    const std::vector<std::string>& s = reports[1];
+    for( std::size_t i = 0; i < p.size(); ++i ) {
+        cout << p[i];
+        if( i >= s.size() || p[i] != s[i] )
+            cout << "  MISMATCH: sequential "
+                 << ( i < s.size() ? s[i] : "(missing)" );
+        cout << endl;
+    }
+    cout << p.size() << " parallel reports, "
+         << s.size() << " sequential reports" << endl;
+
+    for( int i = 0; i < pipeline::stages; ++i ) {
+        cout << "stage " << i << ": " << par.m_stage[i].read();
+        if( par.m_stage[i].read() != seq.m_stage[i].read() )
+            cout << "  MISMATCH: sequential " << seq.m_stage[i].read();
+        cout << endl;
+    }
+    for( std::size_t i = 0; i < errors.size(); ++i )
+        cout << errors[i] << endl;
+    return 0;
+}
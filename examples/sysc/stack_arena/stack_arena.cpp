@@ -0,0 +1,250 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  stack_arena.cpp -- Stacks of thread processes carved out of an arena
+                     (SC_STACK_ARENA).
+
+                     Requires QuickThreads on Linux.  The same design is
+                     simulated in a new simulation context for each setting
+                     of SC_STACK_ARENA.  The threads known at the end of
+                     elaboration locate their stacks in /proc/self/maps:
+
+                     - in an arena, the stacks follow each other in order of
+                       creation,
+                     - without guard pages, the arena is a single mapping,
+                     - a thread spawned during the simulation does not fit
+                       into the rest of the arena and gets a mapping of its
+                       own,
+                     - the arena is unmapped with the last of its stacks,
+                       after the context has been deleted.
+
+                     A run limits the address space of the simulator
+                     below the size of the arena: the reservation fails and
+                     the stacks fall back to a mapping each.  The last runs
+                     override SC_STACK_ARENA by sc_set_stack_arena().
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const int stack_size = 32 * 1024;
+
+// address range of the mapping containing the given address, or 0
+static std::pair<unsigned long, unsigned long> mapping_of( const void* p )
+{
+    const unsigned long addr = reinterpret_cast<unsigned long>( p );
+    std::ifstream maps( "/proc/self/maps" );
+    std::string line;
+    while( std::getline( maps, line ) ) {
+        std::istringstream fields( line );
+        unsigned long begin = 0, end = 0;
+        char dash = 0;
+        fields >> std::hex >> begin >> dash >> end;
+        if( begin <= addr && addr < end )
+            return std::make_pair( begin, end );
+    }
+    return std::make_pair( 0ul, 0ul );
+}
+
+// size of the address space of the simulator
+static unsigned long address_space()
+{
+    std::ifstream status( "/proc/self/status" );
+    std::string line;
+    while( std::getline( status, line ) ) {
+        if( line.compare( 0, 7, "VmSize:" ) == 0 )
+            return std::strtoul( line.c_str() + 7, 0, 10 ) * 1024;
+    }
+    return 0;
+}
+
+SC_MODULE(top)
+{
+    std::vector<const char*> m_stacks; // locals of the worker threads
+    std::string              m_layout; // layout of the stacks
+    unsigned long            m_begin;  // range of the worker mappings
+    unsigned long            m_end;
+    bool                     m_limit;  // limit the address space?
+    int                      m_finished;
+
+    top( sc_module_name, int workers, bool limit )
+      : m_stacks( workers ), m_layout(), m_begin( ~0ul ), m_end( 0 )
+      , m_limit( limit ), m_finished( 0 )
+    {
+        for( int i = 0; i < workers; ++i ) {
+            sc_spawn_options opts;
+            opts.set_stack_size( stack_size );
+            sc_spawn( sc_bind( &top::worker, this, i ), 0, &opts );
+        }
+        SC_HAS_PROCESS(top);
+        SC_THREAD(spawner);
+    }
+
+    void worker( int i )
+    {
+        char local = 0;
+        m_stacks[i] = &local;
+        wait( 1 + i % 3, SC_NS );
+        ++m_finished;
+    }
+
+    // inspects the stacks of the waiting workers, then spawns a thread,
+    // which does not fit into the rest of an arena
+    void spawner()
+    {
+        wait( 500, SC_PS );
+
+        const std::size_t page = sysconf( _SC_PAGESIZE );
+        const std::ptrdiff_t size = ( stack_size + page - 1 ) / page * page;
+        // an arena hands out the stacks at ascending addresses in order of
+        // creation, which is the reverse order of spawning, while separate
+        // mappings are placed at descending addresses
+        bool in_sequence = true;
+        std::set<unsigned long> mappings;
+        for( std::size_t i = 0; i < m_stacks.size(); ++i ) {
+            if( i && m_stacks[i - 1] - m_stacks[i] != size )
+                in_sequence = false;
+            std::pair<unsigned long, unsigned long> m =
+              mapping_of( m_stacks[i] );
+            mappings.insert( m.first );
+            m_begin = std::min( m_begin, m.first );
+            m_end   = std::max( m_end, m.second );
+        }
+        std::ostringstream os;
+        os << "stacks " << ( in_sequence ? "in sequence" : "not in sequence" )
+           << ", ";
+        if( mappings.size() == 1 )
+            os << "1 mapping";
+        else if( mappings.size() == m_stacks.size() )
+            os << "1 mapping per stack";
+        else
+            os << mappings.size() << " mappings";
+        m_layout = os.str();
+
+        sc_spawn_options opts;
+        opts.set_stack_size( 4 * stack_size );
+        sc_spawn( sc_bind( &top::spawned, this ), "spawned", &opts );
+    }
+
+    void spawned()
+    {
+        char local = 0;
+        const unsigned long addr = reinterpret_cast<unsigned long>( &local );
+        if( m_layout.compare( 0, 18, "stacks in sequence" ) == 0 )
+            m_layout += ( addr >= m_begin && addr < m_end )
+                        ? ", spawned thread inside the arena"
+                        : ", spawned thread outside the arena";
+    }
+
+    // the stacks are created right after the start of simulation callbacks
+    void start_of_simulation()
+    {
+        if( !m_limit )
+            return;
+        const unsigned long page = sysconf( _SC_PAGESIZE );
+        const unsigned long stacks = m_stacks.size() * stack_size;
+        const unsigned long slack  = m_stacks.size() * page;
+        struct rlimit limit;
+        getrlimit( RLIMIT_AS, &limit );
+        limit.rlim_cur = address_space() + stacks + slack / 2;
+        setrlimit( RLIMIT_AS, &limit );
+    }
+};
+
+static const char* policy_name( sc_stack_arena_policy policy )
+{
+    switch( policy ) {
+      case SC_STACK_ARENA_GUARD:   return "SC_STACK_ARENA_GUARD";
+      case SC_STACK_ARENA_NOGUARD: return "SC_STACK_ARENA_NOGUARD";
+      case SC_STACK_ARENA_HUGE:    return "SC_STACK_ARENA_HUGE";
+      default:                     return "SC_STACK_ARENA_NONE";
+    }
+}
+
+// policy = overrides SC_STACK_ARENA via sc_set_stack_arena(), if given
+static void simulate( const char* arena, int workers, bool limit = false,
+                      const sc_stack_arena_policy* policy = 0 )
+{
+    if( arena )
+        setenv( "SC_STACK_ARENA", arena, 1 );
+    else
+        unsetenv( "SC_STACK_ARENA" );
+    cout << "SC_STACK_ARENA=" << ( arena ? arena : "" )
+         << ( limit ? ", limited address space" : "" );
+    if( policy )
+        cout << ", sc_set_stack_arena(" << policy_name( *policy ) << ")";
+    cout << endl;
+
+    struct rlimit saved;
+    getrlimit( RLIMIT_AS, &saved );
+
+    sc_simcontext* context = new sc_simcontext;
+    sc_set_curr_simcontext( context );
+    if( policy )
+        sc_set_stack_arena( *policy );
+    sc_report_handler::set_actions( SC_ID_STACK_SETUP_FAILED_,
+                                    SC_DO_NOTHING );
+    top* t = new top( "top", workers, limit );
+    sc_start();
+    setrlimit( RLIMIT_AS, &saved );
+
+    cout << "  " << t->m_layout << endl
+         << "  " << t->m_finished << " of " << workers
+         << " workers finished" << endl;
+    if( limit )
+        cout << "  arena unavailable: "
+             << sc_report_handler::get_count( SC_ID_STACK_SETUP_FAILED_ )
+             << " warning" << endl;
+
+    const char* stack = t->m_stacks.front();
+    delete t;
+    sc_set_curr_simcontext( 0 );
+    delete context;
+    cout << "  context deleted: stacks "
+         << ( mapping_of( stack ).first ? "still mapped" : "unmapped" )
+         << endl;
+}
+
+int sc_main( int, char*[] )
+{
+    simulate( 0, 16 );
+    simulate( "GUARD", 16 );
+    simulate( "NOGUARD", 16 );
+    simulate( "HUGE", 16 );
+    simulate( "NOGUARD", 1024, true );
+    const sc_stack_arena_policy noguard = SC_STACK_ARENA_NOGUARD;
+    const sc_stack_arena_policy none = SC_STACK_ARENA_NONE;
+    simulate( 0, 16, false, &noguard );
+    simulate( "GUARD", 16, false, &none );
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  stack_profile.cpp -- Stack-size profiles (SC_STACK_PROFILE=<file>).
+
+                       Requires QuickThreads.  The same design is simulated
+                       three times with SC_STACK_PROFILE naming a profile
+                       file, which is read when the simulation context is
+                       created and written once at the end of the
+                       simulation:
+
+                       1. stopped by sc_stop(), then the context is deleted,
+                       2. ended by starvation, then the context is deleted,
+                       3. ended by starvation, then sc_main() returns.
+
+                       After each write, the file is replaced by a marker,
+                       which must survive the later ends of the simulation.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+static const char* const profile_file = "stack_profile.prof";
+static const char* const marker = "# not to be overwritten\n";
+
+SC_MODULE(top)
+{
+    SC_CTOR(top)
+    {
+        SC_THREAD(deep);
+        SC_THREAD(shallow);
+    }
+
+    // uses more than 24 KiB of its stack
+    void deep()
+    {
+        wait( 10, SC_NS );
+        volatile char buffer[24 * 1024];
+        for( std::size_t i = 0; i < sizeof(buffer); ++i )
+            buffer[i] = static_cast<char>( i );
+    }
+
+    void shallow()
+    {
+        wait( 20, SC_NS );
+    }
+};
+
+typedef std::map<std::string, std::size_t> profile_map;
+
+static bool is_marker()
+{
+    std::ifstream is( profile_file );
+    std::string line;
+    return std::getline( is, line ) && line + "\n" == marker;
+}
+
+static void write_file( const char* text )
+{
+    std::ofstream os( profile_file );
+    os << text;
+}
+
+// prints the entries of the profile in page units, returns them by name
+static profile_map print_profile( const char* when )
+{
+    const std::size_t page = sysconf( _SC_PAGESIZE );
+    profile_map sizes;
+    cout << "  " << when << ":";
+    if( is_marker() ) {
+        cout << " not written" << endl;
+        return sizes;
+    }
+    std::ifstream is( profile_file );
+    std::string line;
+    while( std::getline( is, line ) ) {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream fields( line );
+        std::string name;
+        std::size_t size = 0;
+        fields >> name >> size;
+        sizes[name] = size;
+        cout << " " << name;
+        if( size % page )
+            cout << " (" << size << " bytes, not page-aligned)";
+    }
+    cout << endl;
+    return sizes;
+}
+
+static std::size_t size_of( const profile_map& sizes, const char* name )
+{
+    profile_map::const_iterator it = sizes.find( name );
+    return ( it != sizes.end() ) ? it->second : 0;
+}
+
+static void print_sizes( const profile_map& sizes )
+{
+    const std::size_t page = sysconf( _SC_PAGESIZE );
+    if( sizes.count( "gone" ) )
+        cout << "  gone: " << size_of( sizes, "gone" ) / page << " pages"
+             << endl;
+    std::size_t deep = size_of( sizes, "top.deep" );
+    std::size_t shallow = size_of( sizes, "top.shallow" );
+    cout << "  top.deep: " << ( deep >= 32 * 1024 ? "at least" : "below" )
+         << " 32 KiB, top.shallow: "
+         << ( shallow >= 32 * 1024 ? "at least" : "below" ) << " 32 KiB"
+         << endl;
+}
+
+// runs the design in a new context, stopped by sc_stop() or by starvation,
+// and deletes the context or leaves it to sc_elab_and_sim()
+static void simulate( bool stop, bool remove )
+{
+    sc_simcontext* context = new sc_simcontext;
+    sc_set_curr_simcontext( context );
+    top* t = new top( "top" );
+    if( stop ) {
+        sc_start( 15, SC_NS );
+        sc_stop();
+        print_sizes( print_profile( "at sc_stop()" ) );
+        write_file( marker );
+    } else {
+        sc_start();
+        print_profile( "at starvation" );
+    }
+    if( !remove )
+        return;
+
+    delete t;
+    sc_set_curr_simcontext( 0 );
+    delete context;
+    profile_map sizes = print_profile( "context deleted" );
+    if( !stop ) {
+        print_sizes( sizes );
+        write_file( marker );
+    }
+}
+
+// written by sc_elab_and_sim() after sc_main() has returned
+static void after_sc_main()
+{
+    print_sizes( print_profile( "after sc_main()" ) );
+    std::remove( profile_file );
+}
+
+int sc_main( int, char*[] )
+{
+    setenv( "SC_STACK_PROFILE", profile_file, 1 );
+    sc_report_handler::set_actions( "/OSCI/SystemC", SC_DO_NOTHING );
+    sc_report_handler::set_actions( SC_ID_STACK_PROFILE_FILE_,
+                                    SC_DO_NOTHING );
+
+    // sizes below four pages are raised, unknown processes are kept
+    write_file( "# process stack_size high_water_mark\n"
+                "gone 100\n"
+                "malformed\n"
+                "top.deep 1048576 1000\n" );
+
+    cout << "run 1, sc_stop() before deleting the context" << endl;
+    simulate( true, true );
+    cout << "run 2, starvation before deleting the context" << endl;
+    simulate( false, true );
+    cout << "run 3, starvation before returning from sc_main()" << endl;
+    simulate( false, false );
+    std::atexit( after_sc_main );
+
+    cout << "malformed lines: "
+         << sc_report_handler::get_count( SC_ID_STACK_PROFILE_FILE_ ) << endl;
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  thread_contexts.cpp -- Concurrent simulations on separate host threads.
+
+                         Requires a library built with
+                         SC_ENABLE_THREAD_LOCAL_CONTEXTS.  Two host threads
+                         elaborate and simulate in their own simulation
+                         contexts at the same time.  Both report a message
+                         type added at run time and a predefined one, with
+                         different actions and limits: the counters and the
+                         limit of each context must only see its own reports.
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+static const char* const note_id = "/thread_contexts/note";
+
+SC_MODULE(reporter)
+{
+    SC_CTOR(reporter)
+    {
+        SC_THREAD(run);
+    }
+
+    void run()
+    {
+        for( int i = 0; i < 1000; ++i ) {
+            SC_REPORT_INFO( note_id, "note" );
+            SC_REPORT_WARNING( SC_ID_IEEE_1666_DEPRECATION_, "deprecated" );
+            wait( 1, SC_NS );
+        }
+    }
+};
+
+// elaborates and simulates in a context of its own, stops after limit notes
+void simulate( int limit, std::string* result )
+{
+    sc_simcontext* context = new sc_simcontext;
+    sc_set_curr_simcontext( context );
+
+    sc_report_handler::set_actions( "/OSCI/SystemC", SC_DO_NOTHING );
+    sc_report_handler::set_actions( note_id, SC_DO_NOTHING );
+    sc_report_handler::set_actions( SC_ID_IEEE_1666_DEPRECATION_,
+                                    SC_DO_NOTHING );
+    if( limit )
+        sc_report_handler::stop_after( note_id, SC_INFO, limit );
+
+    {
+        reporter r( "reporter" );
+        sc_start();
+
+        std::ostringstream os;
+        os << sc_report_handler::get_count( note_id ) << " notes, "
+           << sc_report_handler::get_count( SC_ID_IEEE_1666_DEPRECATION_ )
+           << " deprecation warnings, "
+           << sc_report_handler::get_count( SC_WARNING ) << " warnings,"
+           << " stopped at " << sc_time_stamp();
+        *result = os.str();
+    }
+
+    sc_set_curr_simcontext( 0 );
+    delete context;
+}
+
+int sc_main( int, char*[] )
+{
+    std::string result[2];
+    std::thread first ( simulate, 0,   &result[0] );
+    std::thread second( simulate, 300, &result[1] );
+    first.join();
+    second.join();
+
+    cout << "first context:   " << result[0] << endl;
+    cout << "second context:  " << result[1] << endl;
+    cout << "default context: "
+         << sc_report_handler::get_count( note_id ) << " notes, "
+         << sc_report_handler::get_count( SC_ID_IEEE_1666_DEPRECATION_ )
+         << " deprecation warnings" << endl;
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_cancel.cpp -- Timeouts cancelled within the same time step.
+
+                      Each waiter thread waits with a timeout on an event
+                      that the driver notifies for the very time of the
+                      timeout, and a method does the same via
+                      next_trigger().  Whichever notification of a time
+                      step is triggered first cancels the other one, while
+                      both have already been taken out of the queue of
+                      timed notifications.  Each process must be woken up
+                      exactly once per time step.
+
+                      The queue implementation can be selected via the
+                      environment variable SC_TIMED_QUEUE (HEAP, WHEEL).
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+static const int waiters = 8;
+static const int rounds  = 5;
+
+SC_MODULE(timed_cancel)
+{
+    SC_CTOR(timed_cancel)
+      : m_triggers(0)
+    {
+        for( int k = 0; k < waiters; ++k ) {
+            m_wakeups[k] = 0;
+        }
+        SC_THREAD(driver);
+        for( int k = 0; k < waiters; ++k ) {
+            sc_spawn( sc_bind( &timed_cancel::waiter, this, k ),
+                      sc_gen_unique_name( "waiter" ) );
+        }
+        SC_METHOD(retrigger);
+    }
+
+    void driver()
+    {
+        for( int r = 0; r < rounds; ++r ) {
+            for( int k = 0; k < waiters; ++k ) {
+                m_event[k].notify( 10, SC_NS );
+            }
+            wait( 10, SC_NS );
+        }
+    }
+
+    void waiter( int k )
+    {
+        for( int r = 0; r < rounds; ++r ) {
+            wait( 10, SC_NS, m_event[k] );
+            m_wakeups[k]++;
+        }
+        m_done[k] = sc_time_stamp();
+
+        // a timeout later than the event is cancelled as well
+        m_event[k].notify( 5, SC_NS );
+        wait( 20, SC_NS, m_event[k] );
+        m_last[k] = sc_time_stamp();
+        m_wakeups[k]++;
+    }
+
+    void retrigger()
+    {
+        if( sc_time_stamp() > sc_time( rounds * 10, SC_NS ) ) {
+            return;
+        }
+        cout << sc_time_stamp() << ": method trigger " << m_triggers++ << endl;
+        next_trigger( 10, SC_NS, m_event[0] );
+    }
+
+    // the order of simultaneous wake-ups is unspecified, report per waiter
+    void report() const
+    {
+        for( int k = 0; k < waiters; ++k ) {
+            cout << "waiter " << k << ": " << m_wakeups[k] << " wake-ups, "
+                 << "rounds done at " << m_done[k] << ", last woken at "
+                 << m_last[k] << endl;
+        }
+    }
+
+    sc_event m_event[waiters];
+    int      m_wakeups[waiters];
+    sc_time  m_done[waiters];
+    sc_time  m_last[waiters];
+    int      m_triggers;
+};
+
+int sc_main( int, char*[] )
+{
+    timed_cancel top( "top" );
+    sc_start();
+    top.report();
+    cout << sc_time_stamp() << ": " << sc_pending_activity() << " pending"
+         << endl;
+    return 0;
+}
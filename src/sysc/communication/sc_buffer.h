@@ -74,6 +74,10 @@ public:
     // write the new value
     virtual void write( const T& );
 
+    // direct port access, unless read() or write() may be overridden
+    virtual const void* direct_value() const;
+    virtual sc_signal_channel::direct_write_fn direct_writer() const;
+
 
     // other methods
 
@@ -97,6 +101,8 @@ protected:
 
 private:
 
+    static void direct_write( sc_signal_channel&, const T& );
+
     // disabled
     sc_buffer( const this_type& );
 };
@@ -119,6 +125,36 @@ sc_buffer<T,POL>::write( const T& value_ )
 }
 
 
+// direct port access: only plain buffers qualify
+
+template< typename T, sc_writer_policy POL >
+inline
+const void*
+sc_buffer<T,POL>::direct_value() const
+{
+    return ( typeid( *this ) == typeid( this_type ) ) ? &this->m_cur_val : 0;
+}
+
+template< typename T, sc_writer_policy POL >
+inline
+sc_signal_channel::direct_write_fn
+sc_buffer<T,POL>::direct_writer() const
+{
+    if( typeid( *this ) != typeid( this_type ) )
+        return 0;
+    void (*write_p)( sc_signal_channel&, const T& ) = &this_type::direct_write;
+    return reinterpret_cast<sc_signal_channel::direct_write_fn>( write_p );
+}
+
+template< typename T, sc_writer_policy POL >
+void
+sc_buffer<T,POL>::direct_write( sc_signal_channel& channel_,
+                                const T& value_ )
+{
+    static_cast<this_type&>( channel_ ).this_type::write( value_ );
+}
+
+
 template< typename T, sc_writer_policy POL >
 inline
 void
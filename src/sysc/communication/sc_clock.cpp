@@ -43,10 +43,12 @@
 #endif
 
 #include "sysc/communication/sc_clock.h"
+#include "sysc/communication/sc_clock_domain.h"
 #include "sysc/communication/sc_communication_ids.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_spawn.h"
+#include "sysc/kernel/sc_thread_process.h"
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <sstream>
@@ -66,7 +68,9 @@ sc_clock::sc_clock() :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -81,7 +85,9 @@ sc_clock::sc_clock( const char* name_ ) :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -100,7 +106,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     init( period_,
 	  duty_cycle_,
@@ -124,7 +132,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -146,7 +156,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -172,7 +184,9 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_lazy( simcontext()->m_lazy_clocks ), m_dormant( false ), m_skipping( 0 ),
+    m_domain_p( 0 )
 {
     static bool warn_sc_clock=true;
     if ( warn_sc_clock )
@@ -208,7 +222,8 @@ sc_clock::sc_clock( const char* name_,
 // This callback is used to spawn the edge processes for this object instance.
 // The processes are created here rather than the constructor for the object
 // so that the processes are registered with the global simcontext rather
-// than the scope of the clock's parent.
+// than the scope of the clock's parent.  The edges of clocks in a domain are
+// generated by the process of the domain instead.
 //------------------------------------------------------------------------------
 #if ( defined(_MSC_VER) && _MSC_VER < 1300 ) //VC++6.0 doesn't support sc_spawn with functor.
 #   define sc_clock_posedge_callback(ptr) sc_clock_posedge_callback
@@ -222,6 +237,9 @@ sc_clock::sc_clock( const char* name_,
 
 void sc_clock::before_end_of_elaboration()
 {
+    if( m_domain_p && m_domain_p->elaborate() )
+        return;
+
     std::string gen_base;
     sc_spawn_options posedge_options;	// Options for posedge process.
     sc_spawn_options negedge_options;	// Options for negedge process.
@@ -280,6 +298,256 @@ sc_clock::time_stamp()
 }
 
 
+//------------------------------------------------------------------------------
+//"sc_clock::edge_time"
+//
+// This method computes the time of a future edge of this clock from its
+// static characteristics.  An edge at the current time is still to come,
+// as long as the value of the clock has not been updated, i.e., the edge
+// event is notified in the delta cycle following the update.
+//     edge = posedge_event() or negedge_event() of this clock.
+//     n    = number of the edge, 1 for the next one.
+//     t    = time of the edge, if the result is true.
+//------------------------------------------------------------------------------
+bool
+sc_clock::edge_time( const sc_event& edge, unsigned n, sc_time& t ) const
+{
+    bool posedge = ( &edge == m_posedge_event_p );
+    if( ( !posedge && &edge != m_negedge_event_p ) || n == 0 )
+        return false;
+
+    if( m_dormant )
+        const_cast<sc_clock*>( this )->wake_up();
+
+    sc_dt::uint64 now  = time_stamp().value();
+    sc_dt::uint64 next = next_edge( posedge, now );
+    if( next == now && m_cur_val == posedge )
+        next += m_period.value();
+
+    t = sc_time::from_value( next + ( n - 1 ) * m_period.value() );
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock::next_edge"
+//
+// This method returns the time (value) of the first edge of the given kind
+// at or after time (value) t.  Edges of a kind are at origin + k * period,
+// k >= 0, where the origin is the start time or the time of the first edge
+// of the opposite kind plus its half period.
+//------------------------------------------------------------------------------
+sc_dt::uint64
+sc_clock::next_edge( bool posedge, sc_dt::uint64 t ) const
+{
+    sc_time first = m_start_time;
+    if( posedge != m_posedge_first )
+        first += posedge ? m_posedge_time : m_negedge_time;
+
+    sc_dt::uint64 origin = first.value();
+    sc_dt::uint64 period = m_period.value();
+    if( t <= origin )
+        return origin;
+    return origin + ( ( t - origin + period - 1 ) / period ) * period;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock::set_lazy"
+//
+// This method selects whether the edges of this clock are generated only
+// while processes are sensitive to them.  Once no process is statically or
+// dynamically sensitive to any event of the clock, the edge processes stop
+// rescheduling each other, so that the clock does not cost anything while
+// the design is idle.  Waiting for an event of the clock again as well as
+// reading its value resumes the edges at the position, which follows from
+// the period, duty cycle and start time.
+//
+// Note, the simulation ends by starvation, if nothing but suspended clocks
+// is left.  Lazy clocks are not suspended while trace files are open, since
+// these record the clock's value at each edge.  The edges of a clock, which
+// are generated by a clock domain, are never suspended.
+//------------------------------------------------------------------------------
+void
+sc_clock::set_lazy( bool lazy )
+{
+    m_lazy = lazy && !( m_domain_p && m_domain_p->is_scheduled() );
+    if( !lazy )
+        wake_up();
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock::listened"
+//
+// This method returns true, if a process is sensitive to any event of this
+// clock.  Threads skipping edges in wait(n) do not count, since they resume
+// the edges themselves (see sc_thread_process::skip_clock_cycles).  They are
+// counted by m_skipping, and each of them is statically sensitive to exactly
+// one event of the clock, so comparing the sizes of the frozen static lists
+// takes constant time.
+//
+// While method processes are evaluated in parallel, the edges are never
+// suspended: waking up a clock upon a read would modify the kernel's queues
+// from the host threads of the parallel evaluator.
+//------------------------------------------------------------------------------
+bool
+sc_clock::listened() const
+{
+    sc_simcontext* simc_p = simcontext();
+    if( m_reset_p || simc_p->m_something_to_trace ||
+        simc_p->m_parallel_evaluator )
+        return true;
+
+    const sc_event* events[3] =
+      { m_change_event_p, m_posedge_event_p, m_negedge_event_p };
+    std::size_t static_n = 0;
+    for( int i = 0; i < 3; ++i )
+    {
+        const sc_event* e = events[i];
+        if( !e )
+            continue;
+        if( !e->m_methods_dynamic.empty() || !e->m_threads_dynamic.empty() )
+            return true;
+        if( !e->m_static_frozen )
+            e->freeze_static();
+        static_n += e->m_methods_static.size() + e->m_threads_static.size();
+    }
+    return static_n > static_cast<std::size_t>( m_skipping );
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock::suspend_edges"
+//
+// This method is called by an edge process instead of scheduling the next
+// edge.  The events of the clock wake it up, once a process becomes
+// sensitive to them.
+//------------------------------------------------------------------------------
+void
+sc_clock::suspend_edges()
+{
+    m_dormant = true;
+    if( m_change_event_p )  m_change_event_p->m_lazy_edge = true;
+    if( m_posedge_event_p ) m_posedge_event_p->m_lazy_edge = true;
+    if( m_negedge_event_p ) m_negedge_event_p->m_lazy_edge = true;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock::wake_up"
+//
+// This method resumes the edges of a suspended clock.  The value of the
+// clock is set to the one following from the edges passed in the meantime,
+// without notifying any event.  An edge at the current time is executed as
+// by the edge process, if the clock's update is still to come, i.e., in the
+// first delta cycle of the time step.
+//------------------------------------------------------------------------------
+void
+sc_clock::wake_up()
+{
+    if( !m_dormant )
+        return;
+
+    m_dormant = false;
+    if( m_change_event_p )  m_change_event_p->m_lazy_edge = false;
+    if( m_posedge_event_p ) m_posedge_event_p->m_lazy_edge = false;
+    if( m_negedge_event_p ) m_negedge_event_p->m_lazy_edge = false;
+
+    sc_simcontext* simc_p = simcontext();
+    sc_dt::uint64  now    = simc_p->time_stamp().value();
+    sc_dt::uint64  next_p = next_edge( true, now );
+    sc_dt::uint64  next_n = next_edge( false, now );
+    bool           posedge = next_p < next_n;
+    sc_dt::uint64  next   = posedge ? next_p : next_n;
+
+    if( next != now )
+    {
+        m_cur_val = m_new_val = !posedge;
+        if( posedge )
+            m_next_posedge_event.notify_internal(
+              sc_time::from_value( next - now ) );
+        else
+            m_next_negedge_event.notify_internal(
+              sc_time::from_value( next - now ) );
+    }
+    else if( simc_p->delta_count_at_current_time() == 0 &&
+             !simc_p->update_phase() )
+    {
+        m_cur_val = !posedge;
+        if( posedge )
+            posedge_action();
+        else
+            negedge_action();
+    }
+    else
+    {
+        m_cur_val = m_new_val = posedge;
+        if( simc_p->delta_count_at_current_time() <= 1 )
+            m_change_stamp = simc_p->change_stamp();
+        if( posedge )
+            m_next_negedge_event.notify_internal( m_negedge_time );
+        else
+            m_next_posedge_event.notify_internal( m_posedge_time );
+    }
+}
+
+
+// interface methods, which catch up with suspended edges
+
+const bool&
+sc_clock::read() const
+{
+    if( m_dormant )
+        const_cast<sc_clock*>( this )->wake_up();
+    return m_cur_val;
+}
+
+const bool&
+sc_clock::get_data_ref() const
+{
+    if( m_dormant )
+        const_cast<sc_clock*>( this )->wake_up();
+    return base_type::get_data_ref();
+}
+
+bool
+sc_clock::event() const
+{
+    if( m_dormant )
+        const_cast<sc_clock*>( this )->wake_up();
+    return base_type::event();
+}
+
+// events, which are created while the edges are suspended, wake the clock up
+// as soon as a process becomes sensitive to them
+
+const sc_event&
+sc_clock::lazy_edge( const sc_event& e ) const
+{
+    if( m_dormant )
+        e.m_lazy_edge = true;
+    return e;
+}
+
+const sc_event&
+sc_clock::value_changed_event() const
+{
+    return lazy_edge( base_type::value_changed_event() );
+}
+
+const sc_event&
+sc_clock::posedge_event() const
+{
+    return lazy_edge( base_type::posedge_event() );
+}
+
+const sc_event&
+sc_clock::negedge_event() const
+{
+    return lazy_edge( base_type::negedge_event() );
+}
+
 // error reporting
 
 void
@@ -36,6 +36,8 @@
 
 namespace sc_core {
 
+class sc_clock_domain;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_clock
 //
@@ -108,6 +110,32 @@ public:
 
     static const sc_time& time_stamp();
 
+    // time of the n-th (n > 0) edge to come, which notifies the given event
+    // (posedge_event() or negedge_event()), false for any other event
+    bool edge_time( const sc_event& edge, unsigned n, sc_time& t ) const;
+
+    // generate the edges only while processes are sensitive to them, the
+    // default is taken from sc_set_lazy_clocks() or SC_LAZY_CLOCKS (the
+    // edges are never suspended while methods are evaluated in parallel)
+    void set_lazy( bool lazy );
+    bool is_lazy() const
+        { return m_lazy; }
+
+    // the domain generating the edges of this clock, if any (see
+    // sc_clock_domain::add)
+    sc_clock_domain* domain() const
+        { return m_domain_p; }
+
+    // interface methods, which catch up with suspended edges
+
+    virtual const bool& read() const;
+    virtual const bool& get_data_ref() const;
+    virtual bool event() const;
+
+    virtual const sc_event& value_changed_event() const;
+    virtual const sc_event& posedge_event() const;
+    virtual const sc_event& negedge_event() const;
+
     virtual const char* kind() const
         { return "sc_clock"; }
 
@@ -149,6 +177,13 @@ protected:
 
     void init( const sc_time&, double, const sc_time&, bool );
 
+    // lazy edge generation
+    sc_dt::uint64 next_edge( bool posedge, sc_dt::uint64 t ) const;
+    bool listened() const;
+    void suspend_edges();
+    void wake_up();
+    const sc_event& lazy_edge( const sc_event& ) const;
+
     bool is_clock() const { return true; }
 
 protected:
@@ -163,8 +198,18 @@ protected:
     sc_event m_next_posedge_event;
     sc_event m_next_negedge_event;
 
+    bool     m_lazy;            // generate edges only while sensitive
+    bool     m_dormant;         // edges suspended (lazy clocks only)
+    mutable int m_skipping;     // # of threads skipping edges in wait(n)
+
+    sc_clock_domain* m_domain_p; // domain generating the edges, if any
+
 private:
 
+    friend class sc_clock_domain;
+    friend class sc_event;
+    friend class sc_thread_process;
+
     // disabled
     sc_clock( const sc_clock& );
     sc_clock& operator = ( const sc_clock& );
@@ -179,18 +224,24 @@ inline
 void
 sc_clock::posedge_action()
 {
-    m_next_negedge_event.notify_internal( m_negedge_time );
-	m_new_val = true;
-	request_update();
+    if( m_lazy && !listened() )
+        suspend_edges();
+    else
+        m_next_negedge_event.notify_internal( m_negedge_time );
+    m_new_val = true;
+    request_update();
 }
 
 inline
 void
 sc_clock::negedge_action()
 {
-    m_next_posedge_event.notify_internal( m_posedge_time );
-	m_new_val = false;
-	request_update();
+    if( m_lazy && !listened() )
+        suspend_edges();
+    else
+        m_next_posedge_event.notify_internal( m_posedge_time );
+    m_new_val = false;
+    request_update();
 }
 
 
@@ -0,0 +1,269 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_clock_domain.cpp -- Common edge schedule of related clocks
+
+ *****************************************************************************/
+
+#include "sysc/communication/sc_clock_domain.h"
+#include "sysc/communication/sc_clock.h"
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/kernel/sc_spawn.h"
+
+#include <algorithm> // std::sort
+#include <sstream>
+
+namespace sc_core {
+
+namespace {
+
+// maximum number of edges in the schedule of a domain
+const std::size_t max_domain_edges = 65536;
+
+struct timed_edge
+{
+    sc_dt::uint64 time;
+    std::size_t   clock;   // index of the clock within the domain.
+    bool          posedge;
+
+    bool operator < ( const timed_edge& other ) const
+    {
+        return time < other.time
+            || ( time == other.time && clock < other.clock );
+    }
+};
+
+sc_dt::uint64 gcd( sc_dt::uint64 a, sc_dt::uint64 b )
+{
+    while( b != 0 ) {
+        sc_dt::uint64 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_clock_domain_callback
+//
+//  Functor of the edge process of a domain.
+// ----------------------------------------------------------------------------
+
+class sc_clock_domain_callback {
+public:
+    sc_clock_domain_callback(sc_clock_domain* target_p) : m_target_p(target_p) {}
+    inline void operator () () { m_target_p->edges_action(); }
+  protected:
+    sc_clock_domain* m_target_p;
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_clock_domain
+//
+//  Merged edge generation of a set of clocks.
+// ----------------------------------------------------------------------------
+
+sc_clock_domain::sc_clock_domain( const char* name_ )
+  : sc_object( name_ )
+  , m_clocks(), m_times(), m_first(), m_edges()
+  , m_periodic( 0 ), m_hyperperiod( 0 ), m_base( 0 ), m_next( 0 )
+  , m_elaborated( false ), m_scheduled( false )
+  , m_next_edges_event( sc_event::kernel_event, "next_edges_event" )
+{}
+
+sc_clock_domain::~sc_clock_domain()
+{}
+
+void
+sc_clock_domain::add( sc_clock& clock_ )
+{
+    if( clock_.m_domain_p == this )
+        return;
+
+    std::stringstream msg;
+    if( m_elaborated || sc_get_status() != SC_ELABORATION ) {
+        msg << clock_.name() << " (" << name() << "): after elaboration";
+        SC_REPORT_ERROR( SC_ID_ADD_CLOCK_TO_DOMAIN_, msg.str().c_str() );
+        return;
+    }
+    if( clock_.m_domain_p ) {
+        msg << clock_.name() << " (" << name() << "): already in "
+            << clock_.m_domain_p->name();
+        SC_REPORT_ERROR( SC_ID_ADD_CLOCK_TO_DOMAIN_, msg.str().c_str() );
+        return;
+    }
+
+    clock_.m_domain_p = this;
+    m_clocks.push_back( &clock_ );
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock_domain::elaborate"
+//
+// This method is called from the before_end_of_elaboration callback of each
+// clock of the domain.  The first call builds the schedule, cancels the first
+// edges notified by the constructors of the clocks and spawns the process of
+// the domain.  The result is false, if the clocks shall spawn their own edge
+// processes instead.
+//------------------------------------------------------------------------------
+bool
+sc_clock_domain::elaborate()
+{
+    if( m_elaborated )
+        return m_scheduled;
+    m_elaborated = true;
+
+    if( !build_schedule() ) {
+        std::stringstream msg;
+        msg << name() << " (" << m_clocks.size() << " clocks)";
+        SC_REPORT_WARNING( SC_ID_CLOCK_DOMAIN_TOO_LARGE_, msg.str().c_str() );
+        m_times.clear();
+        m_first.clear();
+        m_edges.clear();
+        m_hyperperiod = 0;
+        return false;
+    }
+    m_scheduled = true;
+
+    for( std::size_t i = 0; i < m_clocks.size(); ++i ) {
+        m_clocks[i]->m_next_posedge_event.cancel();
+        m_clocks[i]->m_next_negedge_event.cancel();
+        m_clocks[i]->m_lazy = false;
+    }
+
+    sc_spawn_options options;
+    options.spawn_method();
+    options.dont_initialize();
+    options.set_sensitivity( &m_next_edges_event );
+    std::string gen_base = basename();
+    gen_base += "_edges_action";
+    sc_spawn( sc_clock_domain_callback( this ),
+      sc_gen_unique_name( gen_base.c_str() ), &options );
+
+    m_next_edges_event.notify_internal( sc_time::from_value( m_times[0] ) );
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock_domain::build_schedule"
+//
+// This method merges the edges of the clocks into a table of distinct edge
+// times.  Each kind of edge of a clock repeats with the clock's period from
+// its first occurrence on.  Hence, all edges repeat with the hyperperiod
+// from the latest first edge on.  The table holds the edges before it once
+// and the edges of a single hyperperiod following it.  The result is false,
+// if the table would exceed max_domain_edges.
+//------------------------------------------------------------------------------
+bool
+sc_clock_domain::build_schedule()
+{
+    typedef sc_dt::uint64 uint64;
+    const uint64 max_value = ~uint64( 0 );
+
+    uint64 hyper  = 1;
+    uint64 repeat = 0; // start of the repeated part.
+    for( std::size_t i = 0; i < m_clocks.size(); ++i )
+    {
+        uint64 period = m_clocks[i]->m_period.value();
+        uint64 factor = hyper / gcd( hyper, period );
+        if( factor > max_value / period )
+            return false;
+        hyper = factor * period;
+
+        repeat = std::max( repeat, m_clocks[i]->next_edge( true, 0 ) );
+        repeat = std::max( repeat, m_clocks[i]->next_edge( false, 0 ) );
+    }
+    if( repeat > max_value - hyper )
+        return false;
+    uint64 end = repeat + hyper;
+
+    std::vector<timed_edge> edges;
+    for( std::size_t i = 0; i < m_clocks.size(); ++i )
+    {
+        uint64 period = m_clocks[i]->m_period.value();
+        for( int kind = 0; kind < 2; ++kind )
+        {
+            timed_edge e;
+            e.time    = m_clocks[i]->next_edge( kind == 0, 0 );
+            e.clock   = i;
+            e.posedge = ( kind == 0 );
+
+            if( ( end - e.time - 1 ) / period >= max_domain_edges - edges.size() )
+                return false;
+            for( ; e.time < end; e.time += period )
+                edges.push_back( e );
+        }
+    }
+    std::sort( edges.begin(), edges.end() );
+
+    m_edges.reserve( edges.size() );
+    for( std::size_t i = 0; i < edges.size(); ++i )
+    {
+        if( m_times.empty() || m_times.back() != edges[i].time ) {
+            if( edges[i].time == repeat )
+                m_periodic = m_times.size();
+            m_times.push_back( edges[i].time );
+            m_first.push_back( i );
+        }
+        edge e = { m_clocks[edges[i].clock], edges[i].posedge };
+        m_edges.push_back( e );
+    }
+    m_first.push_back( m_edges.size() );
+
+    m_hyperperiod = hyper;
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_clock_domain::edges_action"
+//
+// This method is the process of the domain.  It executes the edges of the
+// current entry of the schedule, like the edge processes of the clocks, and
+// notifies the time of the next entry.  After the last entry, the schedule
+// continues with the repeated part, one hyperperiod later.
+//------------------------------------------------------------------------------
+void
+sc_clock_domain::edges_action()
+{
+    for( std::size_t i = m_first[m_next]; i < m_first[m_next + 1]; ++i )
+    {
+        sc_clock* clock_p = m_edges[i].clock_p;
+        clock_p->m_new_val = m_edges[i].posedge;
+        clock_p->request_update();
+    }
+
+    sc_dt::uint64 now = entry_time( m_next );
+    if( ++m_next == m_times.size() ) {
+        m_next  = m_periodic;
+        m_base += m_hyperperiod;
+    }
+    m_next_edges_event.notify_internal(
+      sc_time::from_value( entry_time( m_next ) - now ) );
+}
+
+} // namespace sc_core
+
+// Taf!
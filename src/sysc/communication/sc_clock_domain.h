@@ -0,0 +1,131 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_clock_domain.h -- Common edge schedule of related clocks
+
+  A clock domain generates the edges of a set of clocks by a single
+  process.  At the end of elaboration, the edges of all clocks are merged
+  into a schedule over the hyperperiod of the clocks, i.e., the least
+  common multiple of their periods.  Each distinct edge time is a single
+  timed notification of the kernel, which executes all coincident edges
+  together.  The clocks change their values at the same times and in the
+  same delta cycles as without the domain.
+
+  If the schedule would exceed a fixed number of edges (e.g., for periods
+  without a small common multiple), a warning is issued and the clocks
+  generate their edges separately.
+
+ *****************************************************************************/
+
+#ifndef SC_CLOCK_DOMAIN_H_INCLUDED_
+#define SC_CLOCK_DOMAIN_H_INCLUDED_
+
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_object.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_clock;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_clock_domain
+//
+//  Merged edge generation of a set of clocks.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_clock_domain
+  : public sc_object
+{
+    friend class sc_clock;
+    friend class sc_clock_domain_callback;
+
+public:
+
+    explicit sc_clock_domain(
+      const char* name_ = sc_gen_unique_name( "clock_domain" ) );
+
+    virtual ~sc_clock_domain();
+
+    // add a clock to this domain, during elaboration only
+    void add( sc_clock& clock_ );
+
+    const std::vector<sc_clock*>& clocks() const
+        { return m_clocks; }
+
+    // are the edges generated by this domain (known after elaboration)?
+    bool is_scheduled() const
+        { return m_scheduled; }
+
+    // the hyperperiod of the clocks, zero if not scheduled
+    sc_time hyperperiod() const
+        { return sc_time::from_value( m_hyperperiod ); }
+
+    virtual const char* kind() const
+        { return "sc_clock_domain"; }
+
+protected:
+
+    // called by the clocks of the domain, true if the domain generates
+    // their edges
+    bool elaborate();
+
+    bool build_schedule();
+
+    sc_dt::uint64 entry_time( std::size_t i ) const
+        { return m_times[i] + ( i < m_periodic ? 0 : m_base ); }
+
+    // process
+    void edges_action();
+
+private:
+
+    struct edge
+    {
+        sc_clock* clock_p;
+        bool      posedge;
+    };
+
+    std::vector<sc_clock*>     m_clocks;      // clocks of the domain.
+    std::vector<sc_dt::uint64> m_times;       // distinct edge times.
+    std::vector<std::size_t>   m_first;       // first edge per edge time.
+    std::vector<edge>          m_edges;       // edges ordered by time.
+    std::size_t                m_periodic;    // first entry repeated.
+    sc_dt::uint64              m_hyperperiod; // period of the schedule.
+    sc_dt::uint64              m_base;        // offset of repeated entries.
+    std::size_t                m_next;        // next entry to execute.
+    bool                       m_elaborated;  // elaborate() has been called.
+    bool                       m_scheduled;   // edges generated by domain.
+    sc_event                   m_next_edges_event;
+
+private:
+    // disabled
+    sc_clock_domain( const sc_clock_domain& );
+    sc_clock_domain& operator = ( const sc_clock_domain& );
+};
+
+} // namespace sc_core
+
+#endif // SC_CLOCK_DOMAIN_H_INCLUDED_
+
+// Taf!
@@ -107,6 +107,10 @@ SC_DEFINE_MESSAGE( SC_ID_ATTEMPT_TO_BIND_CLOCK_TO_OUTPUT_,  128,
     "attempted to bind sc_clock instance to sc_inout or sc_out" )
 SC_DEFINE_MESSAGE( SC_ID_NO_ASYNC_UPDATE_,  129,
     "this build has no asynchronous update support" )
+SC_DEFINE_MESSAGE( SC_ID_ADD_CLOCK_TO_DOMAIN_,  130,
+    "sc_clock instance cannot be added to sc_clock_domain" )
+SC_DEFINE_MESSAGE( SC_ID_CLOCK_DOMAIN_TOO_LARGE_,  131,
+    "edge schedule of sc_clock_domain too large, clocks run separately" )
 
 /* 
 $Log: sc_communication_ids.h,v $
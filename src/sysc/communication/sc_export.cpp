@@ -29,6 +29,7 @@
 
 #include "sysc/communication/sc_export.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_elab_profiler.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
 
@@ -53,7 +54,8 @@ sc_export_base::sc_export_base(const char* name_) : sc_object(name_)
     
 sc_export_base::~sc_export_base()
 {
-    simcontext()->get_export_registry()->remove(this);
+    if ( !simcontext()->in_fast_teardown() )
+        simcontext()->get_export_registry()->remove(this);
 }
 
 // called by construction_done() (does nothing by default)
@@ -225,6 +227,8 @@ sc_export_registry::construction_done()
       return true;
 
     for( int i = size()-1; i >= m_construction_done; --i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_export_vec[i] );
 	m_export_vec[i]->construction_done();
     }
 
@@ -238,6 +242,8 @@ void
 sc_export_registry::elaboration_done()
 {
     for( int i = size() - 1; i >= 0; -- i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_export_vec[i] );
 	m_export_vec[i]->elaboration_done();
     }
 }
@@ -248,6 +254,8 @@ void
 sc_export_registry::start_simulation()
 {
     for( int i = size() - 1; i >= 0; -- i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_export_vec[i] );
 	m_export_vec[i]->start_simulation();
     }
 }
@@ -27,6 +27,7 @@
  *****************************************************************************/
 
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_elab_profiler.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
 #include "sysc/kernel/sc_method_process.h"
@@ -263,7 +264,8 @@ sc_port_base::sc_port_base(
 
 sc_port_base::~sc_port_base()
 {
-    simcontext()->get_port_registry()->remove( this );
+    if ( !simcontext()->in_fast_teardown() )
+        simcontext()->get_port_registry()->remove( this );
     free_binding();
     delete m_bind_info;
 }
@@ -403,51 +405,48 @@ sc_port_base::make_sensitive( sc_method_handle handle_,
 
 // support methods
 
-int
-sc_port_base::first_parent()
-{
-    for( int i = 0; i < m_bind_info->size(); ++ i ) {
-	if( m_bind_info->vec[i]->parent != 0 ) {
-	    return i;
-	}
-    }
-    return -1;
-}
-
 void
-sc_port_base::insert_parent( int i )
+sc_port_base::insert_parents()
 {
     std::vector<sc_bind_elem*>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem*>  expanded;
+    expanded.reserve( vec.size() );
+
+    for( std::size_t i = 0; i < vec.size(); ++ i ) {
+        this_type* parent = vec[i]->parent;
+        expanded.push_back( vec[i] );
+        if( parent == 0 ) {
+            continue;
+        }
 
-    this_type* parent = vec[i]->parent;
+        // COMPLETE BINDING OF THE PARENT PORT, SO THAT WE CAN USE ITS
+        // INTERFACES:
+        //
+        // The binding of each port is completed only once, so that a chain
+        // of port-to-port bindings is resolved in linear time.
 
+        {
+            sc_elab_profiler::scope timer( simcontext()->get_elab_profiler(),
+                                           *parent );
+            parent->complete_binding();
+        }
+        vec[i]->parent = 0;
 
-    // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
-    //
-    // Note that the zeroing of the parent pointer must occur before this
-    // test
-
-    vec[i]->parent = 0;
-    if ( parent->m_bind_info->vec.size() == 0 ) return;
-
-    vec[i]->iface = parent->m_bind_info->vec[0]->iface;
-    int n = parent->m_bind_info->size() - 1;
-    if( n > 0 ) {
-	// resize the bind vector (by adding new elements)
-	for( int k = 0; k < n; ++ k ) {
-	    vec.push_back( new sc_bind_elem() );
-	}
-	// move elements in the bind vector
-	for( int k = m_bind_info->size() - n - 1; k > i; -- k ) {
-	    vec[k + n]->iface = vec[k]->iface;
-	    vec[k + n]->parent = vec[k]->parent;
-	}
-	// insert parent interfaces into the bind vector
-	for( int k = i + 1; k <= i + n; ++ k ) {
-	    vec[k]->iface = parent->m_bind_info->vec[k - i]->iface;
-	    vec[k]->parent = 0;
-	}
+        // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
+
+        const std::vector<sc_bind_elem*>& parent_vec =
+          parent->m_bind_info->vec;
+        if( parent_vec.size() == 0 ) {
+            continue;
+        }
+
+        // insert parent interfaces into the bind vector
+        vec[i]->iface = parent_vec[0]->iface;
+        for( std::size_t k = 1; k < parent_vec.size(); ++ k ) {
+            expanded.push_back( new sc_bind_elem( parent_vec[k]->iface ) );
+        }
     }
+    vec.swap( expanded );
 }
 
 
@@ -463,13 +462,10 @@ sc_port_base::complete_binding()
         return;
     }
 
-    // COMPLETE BINDING OF OUR PARENT PORTS SO THAT WE CAN USE THAT INFORMATION:
+    // REPLACE OUR PARENT PORTS BY THEIR INTERFACES:
 
-    int i = first_parent();
-    while( i >= 0 ) {
-        m_bind_info->vec[i]->parent->complete_binding();
-        insert_parent( i );
-        i = first_parent();
+    if( m_bind_info->has_parent ) {
+        insert_parents();
     }
 
     // LOOP OVER BINDING INFORMATION TO COMPLETE THE BINDING PROCESS:
@@ -702,6 +698,8 @@ sc_port_registry::construction_done()
         return true;
 
     for( int i = size()-1; i >= m_construction_done; --i ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_port_vec[i] );
         m_port_vec[i]->construction_done();
     }
 
@@ -715,6 +713,8 @@ void
 sc_port_registry::complete_binding()
 {
     for( int i = size() - 1; i >= 0; -- i ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_port_vec[i] );
         m_port_vec[i]->complete_binding();
     }
 }
@@ -725,9 +725,9 @@ sc_port_registry::complete_binding()
 void
 sc_port_registry::elaboration_done()
 {
-    complete_binding();
-
     for( int i = size() - 1; i >= 0; -- i ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_port_vec[i] );
         m_port_vec[i]->elaboration_done();
     }
 }
@@ -738,6 +738,8 @@ void
 sc_port_registry::start_simulation()
 {
     for( int i = size() - 1; i >= 0; -- i ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_port_vec[i] );
         m_port_vec[i]->start_simulation();
     }
 }
@@ -165,8 +165,7 @@ private:
 
 
     // support methods
-    int first_parent();
-    void insert_parent( int );
+    void insert_parents();
 
     // called when construction is done
     void construction_done();
@@ -224,7 +223,7 @@ private:
     // destructor
     ~sc_port_registry();
 
-    // called when by construction_done and elaboration done
+    // called after construction_done, before elaboration_done
     void complete_binding();
 
     // called when construction is done
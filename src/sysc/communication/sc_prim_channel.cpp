@@ -30,8 +30,12 @@
 #include "sysc/communication/sc_prim_channel.h"
 #include "sysc/communication/sc_communication_ids.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_elab_profiler.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_task.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
 #  include "sysc/communication/sc_host_mutex.h"
@@ -39,6 +43,7 @@
 #endif
 
 #include <algorithm> // std::find
+#include <map>
 
 namespace sc_core {
 
@@ -53,7 +58,8 @@ namespace sc_core {
 sc_prim_channel::sc_prim_channel()
 : sc_object( 0 ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 ) 
+  m_update_next_p( 0 ),
+  m_async_next_p( 0 )
 {
     m_registry->insert( *this );
 }
@@ -61,7 +67,8 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 )
+  m_update_next_p( 0 ),
+  m_async_next_p( 0 )
 {
     m_registry->insert( *this );
 }
@@ -71,7 +78,8 @@ sc_prim_channel::sc_prim_channel( const char* name_ )
 
 sc_prim_channel::~sc_prim_channel()
 {
-    m_registry->remove( *this );
+    if ( !simcontext()->in_fast_teardown() )
+        m_registry->remove( *this );
 }
 
 
@@ -145,7 +153,16 @@ sc_prim_channel::simulation_done()
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel_registry::async_update_list
 //
-//  Thread-safe list of pending external updates
+//  Lock-free lists of pending external updates and posted kernel tasks
+//
+//  Any number of host threads may append channels concurrently, while only
+//  the simulator thread accepts them.  A channel is linked into the list
+//  via its m_async_next_p member, which is non-zero while it is queued.
+//  Hence, repeated requests of a queued channel are merged and appending
+//  never allocates memory.  The simulator detaches the whole list at once
+//  and restores the order of the requests before accepting them.  Kernel
+//  tasks are linked the same way, but are never merged.
+//
 //  FOR INTERNAL USE ONLY!
 // ----------------------------------------------------------------------------
 
@@ -156,45 +173,98 @@ public:
 
     bool pending() const
     {
-	return m_push_queue.size() != 0;
+	return m_head_p.load() != 0 || pending_tasks();
     }
 
+    bool pending_tasks() const
+    {
+	return m_task_head_p.load() != 0;
+    }
+
+    // block the simulator until the next external update, if there are
+    // attached suspending channels (without spinning)
+
     void suspend()
     {
-        if( m_has_suspending_channels ) {
-            m_suspend_semaphore.wait();
-            m_suspend_semaphore.post(); // replace token
-        }
+        if( !m_has_suspending_channels.load() )
+            return;
+
+        m_waiting.store( true );
+        if( pending() && m_waiting.exchange( false ) )
+            return; // no appending thread will post the semaphore
+
+        // the thread resetting m_waiting posts (or has posted) the semaphore
+        m_wakeup_semaphore.wait();
     }
 
     void append( sc_prim_channel& prim_channel_ )
     {
-        sc_scoped_lock lock( m_mutex );
-        m_push_queue.push_back( &prim_channel_ );
-        m_suspend_semaphore.post();
-        // return releases the mutex
+        sc_prim_channel* const end_p = (sc_prim_channel*)sc_prim_channel::list_end;
+
+        // claim the channel, skip duplicates of already queued channels
+        sc_prim_channel* next_p = 0;
+        if( !prim_channel_.m_async_next_p.compare_exchange( next_p, end_p ) )
+            return;
+
+        sc_prim_channel* head_p = m_head_p.load();
+        do {
+            prim_channel_.m_async_next_p.store( head_p ? head_p : end_p );
+        } while( !m_head_p.compare_exchange( head_p, &prim_channel_ ) );
+
+        wakeup();
+    }
+
+    void append_task( sc_kernel_task& task_ )
+    {
+        sc_kernel_task* head_p = m_task_head_p.load();
+        do {
+            task_.m_next_p = head_p;
+        } while( !m_task_head_p.compare_exchange( head_p, &task_ ) );
+
+        wakeup();
     }
 
     void accept_updates()
     {
-	sc_assert( ! m_pop_queue.size() );
-	{
-	    sc_scoped_lock lock( m_mutex );
-	    m_push_queue.swap( m_pop_queue );
-	    // leaving the block releases the mutex
-	}
+        sc_prim_channel* const end_p = (sc_prim_channel*)sc_prim_channel::list_end;
+
+        // detach the whole list (in reverse order of the requests)
+        sc_prim_channel* now_p = m_head_p.exchange( 0 );
+        sc_prim_channel* next_p;
+        sc_prim_channel* prev_p = end_p;
+        for( ; now_p != 0 && now_p != end_p; now_p = next_p )
+        {
+            next_p = now_p->m_async_next_p.load();
+            now_p->m_async_next_p.store( prev_p );
+            prev_p = now_p;
+        }
 
-	std::vector< sc_prim_channel* >::const_iterator
-	    it = m_pop_queue.begin(), end = m_pop_queue.end();
-	while( it!= end )
-	{
-	    // we use request_update instead of perform_update
-	    // to skip duplicates
-	    (*it++)->request_update();
-	    int sem_trywait = m_suspend_semaphore.trywait(); // this must never block !
-	    sc_assert( sem_trywait == 0 );
-	}
-	m_pop_queue.clear();
+        // release each channel before requesting its update, so that a
+        // concurrent external request is not lost
+        for( now_p = prev_p; now_p != end_p; now_p = next_p )
+        {
+            next_p = now_p->m_async_next_p.load();
+            now_p->m_async_next_p.store( 0 );
+            // we use request_update instead of perform_update
+            // to skip duplicates
+            now_p->request_update();
+        }
+    }
+
+    // detach the posted tasks, returns the first task in posting order
+
+    sc_kernel_task* accept_tasks()
+    {
+        sc_kernel_task* now_p = m_task_head_p.exchange( 0 );
+        sc_kernel_task* next_p;
+        sc_kernel_task* prev_p = 0;
+        for( ; now_p != 0; now_p = next_p )
+        {
+            next_p = now_p->m_next_p;
+            now_p->m_next_p = prev_p;
+            prev_p = now_p;
+        }
+        return prev_p;
     }
 
     bool attach_suspending( sc_prim_channel& p )
@@ -204,7 +274,7 @@ public:
           std::find(m_suspending_channels.begin(), m_suspending_channels.end(), &p);
         if ( it == m_suspending_channels.end() ) {
             m_suspending_channels.push_back(&p);
-            m_has_suspending_channels = true;
+            m_has_suspending_channels.store( true );
             return true;
         }
         return false;
@@ -219,26 +289,74 @@ public:
         if ( it != m_suspending_channels.end() ) {
             *it = m_suspending_channels.back();
             m_suspending_channels.pop_back();
-            m_has_suspending_channels = (m_suspending_channels.size() > 0);
+            m_has_suspending_channels.store( m_suspending_channels.size() > 0 );
             return true;
         }
         return false;
         // return releases the mutex
     }
 
-    async_update_list() : m_has_suspending_channels() {}
+    async_update_list()
+      : m_head_p( 0 ), m_task_head_p( 0 ), m_waiting( false )
+      , m_has_suspending_channels( false )
+    {}
+
+    ~async_update_list()
+    {
+        sc_kernel_task* next_p;
+        for( sc_kernel_task* now_p = accept_tasks(); now_p; now_p = next_p ) {
+            next_p = now_p->m_next_p;
+            delete now_p;
+        }
+    }
+
+private:
+
+    // wake up a suspended simulator
+    void wakeup()
+    {
+        if( m_waiting.load() && m_waiting.exchange( false ) )
+            m_wakeup_semaphore.post();
+    }
 
 private:
-    sc_host_mutex                   m_mutex;
-    sc_host_semaphore               m_suspend_semaphore;
-    std::vector< sc_prim_channel* > m_push_queue;
-    std::vector< sc_prim_channel* > m_pop_queue;
-    std::vector< sc_prim_channel* > m_suspending_channels;
-    bool                            m_has_suspending_channels;
+    sc_host_atomic<sc_prim_channel*> m_head_p;   // last appended channel.
+    sc_host_atomic<sc_kernel_task*>  m_task_head_p; // last posted task.
+    sc_host_atomic<bool>             m_waiting;  // simulator is suspending.
+    sc_host_semaphore                m_wakeup_semaphore;
+    sc_host_mutex                    m_mutex;    // suspending channels.
+    std::vector< sc_prim_channel* >  m_suspending_channels;
+    sc_host_atomic<bool>             m_has_suspending_channels;
 
 #endif // ! SC_DISABLE_ASYNC_UPDATES
 };
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_prim_channel_registry::timed_task_list
+//
+//  Accepted kernel tasks, ordered by due time and (for the same due time)
+//  by posting order.  Only accessed by the simulator thread.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class sc_prim_channel_registry::timed_task_list
+{
+public:
+    typedef std::multimap<sc_time, sc_kernel_task*> map_type;
+
+    timed_task_list() : m_tasks(), m_event_p( 0 ) {}
+
+    ~timed_task_list()
+    {
+        for( map_type::iterator it = m_tasks.begin(); it != m_tasks.end(); ++it )
+            delete it->second;
+        delete m_event_p;
+    }
+
+    map_type  m_tasks;   // tasks by due time.
+    sc_event* m_event_p; // notified at the earliest due time.
+};
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel_registry
 //
@@ -329,6 +447,29 @@ sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_ )
 #endif
 }
 
+void
+sc_prim_channel_registry::async_post( sc_kernel_task& task_ )
+{
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    m_async_update_list_p->append_task( task_ );
+#else
+    delete &task_;
+    SC_REPORT_ERROR( SC_ID_NO_ASYNC_UPDATE_, "sc_post_kernel_task" );
+#endif
+}
+
+// collect update requests of parallel-safe method processes, which are
+// committed by the parallel evaluator in a deterministic order
+
+void
+sc_prim_channel_registry::defer_update( sc_prim_channel& prim_channel_ )
+{
+    if( !sc_parallel_evaluator::defer_update( prim_channel_ ) ) {
+        prim_channel_.m_update_next_p = m_update_list_p;
+        m_update_list_p = &prim_channel_;
+    }
+}
+
 bool
 sc_prim_channel_registry::async_attach_suspending(sc_prim_channel& p)
 {
@@ -351,13 +492,81 @@ sc_prim_channel_registry::async_detach_suspending(sc_prim_channel& p)
 #endif
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::pending_tasks"
+// |
+// | This method returns true, if tasks have been posted since the last update
+// | phase or accepted tasks are due at the current time.
+// +----------------------------------------------------------------------------
+bool
+sc_prim_channel_registry::pending_tasks() const
+{
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    if( m_async_update_list_p->pending_tasks() )
+        return true;
+#endif
+    if( m_timed_task_count == 0 )
+        return false;
+    timed_task_list::map_type& tasks = m_timed_task_list_p->m_tasks;
+    return tasks.begin()->first <= m_simc->time_stamp();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::schedule_task"
+// |
+// | This method inserts a newly accepted task into the list of timed tasks.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::schedule_task( sc_kernel_task* task_p )
+{
+    if( !m_timed_task_list_p ) {
+        m_timed_task_list_p = new timed_task_list;
+    }
+    m_timed_task_list_p->m_tasks.insert( timed_task_list::map_type::value_type(
+      m_simc->time_stamp() + task_p->delay(), task_p ) );
+    ++m_timed_task_count;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::run_tasks"
+// |
+// | This method executes all tasks due at the current time and arranges for
+// | the simulator to return at the due time of the next task.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::run_tasks()
+{
+    timed_task_list::map_type& tasks = m_timed_task_list_p->m_tasks;
+    const sc_time& now = m_simc->time_stamp();
+
+    while( !tasks.empty() && tasks.begin()->first <= now )
+    {
+        sc_kernel_task* task_p = tasks.begin()->second;
+        tasks.erase( tasks.begin() );
+        --m_timed_task_count;
+        task_p->run();
+        delete task_p;
+    }
+
+    if( !tasks.empty() )
+    {
+        sc_event*& event_p = m_timed_task_list_p->m_event_p;
+        if( !event_p ) {
+            event_p = new sc_event( sc_event::kernel_event, "kernel_task" );
+        }
+        event_p->notify( tasks.begin()->first - now );
+    }
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_prim_channel_registry::perform_update"
 // |
 // | This method updates the values of the primitive channels in its update
 // | lists.
+// |
+// | Result is the number of updated primitive channels.
 // +----------------------------------------------------------------------------
-void
+std::size_t
 sc_prim_channel_registry::perform_update()
 {
     // Update the values for the primitive channels set external to the
@@ -365,11 +574,28 @@ sc_prim_channel_registry::perform_update()
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
     if( m_async_update_list_p->pending() )
+    {
 	m_async_update_list_p->accept_updates();
+
+	sc_kernel_task* next_p;
+	sc_kernel_task* task_p = m_async_update_list_p->accept_tasks();
+	for( ; task_p != 0; task_p = next_p )
+	{
+	    next_p = task_p->m_next_p;
+	    schedule_task( task_p );
+	}
+    }
 #endif
 
+    // Execute the tasks due at the current time, before their
+    // update requests are processed below.
+
+    if( m_timed_task_count != 0 )
+	run_tasks();
+
     sc_prim_channel* next_p; // Next update to perform.
     sc_prim_channel* now_p;  // Update now performing.
+    std::size_t      count = 0;
 
     // Update the values for the primitive channels in the simulator's list.
 
@@ -380,17 +606,22 @@ sc_prim_channel_registry::perform_update()
     {
 	next_p = now_p->m_update_next_p;
 	now_p->perform_update();
+	++count;
     }
+    return count;
 }
 
 // constructor
 
 sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
   :  m_async_update_list_p(0)
+  ,  m_timed_task_list_p(0)
+  ,  m_timed_task_count(0)
   ,  m_construction_done(0)
   ,  m_prim_channel_vec()
   ,  m_simc( &simc_ )
   ,  m_update_list_p((sc_prim_channel*)sc_prim_channel::list_end)
+  ,  m_defer_updates(false)
 {
 #   ifndef SC_DISABLE_ASYNC_UPDATES
         m_async_update_list_p = new async_update_list();
@@ -402,6 +633,7 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
 
 sc_prim_channel_registry::~sc_prim_channel_registry()
 {
+    delete m_timed_task_list_p;
     delete m_async_update_list_p;
 }
 
@@ -415,6 +647,8 @@ sc_prim_channel_registry::construction_done()
         return true;
 
     for( ; m_construction_done < size(); ++m_construction_done ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_prim_channel_vec[m_construction_done] );
         m_prim_channel_vec[m_construction_done]->construction_done();
     }
 
@@ -428,6 +662,8 @@ void
 sc_prim_channel_registry::elaboration_done()
 {
     for( int i = 0; i < size(); ++ i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_prim_channel_vec[i] );
 	m_prim_channel_vec[i]->elaboration_done();
     }
 }
@@ -438,6 +674,8 @@ void
 sc_prim_channel_registry::start_simulation()
 {
     for( int i = 0; i < size(); ++ i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_prim_channel_vec[i] );
 	m_prim_channel_vec[i]->start_simulation();
     }
 }
@@ -30,11 +30,14 @@
 #define SC_PRIM_CHANNEL_H
 
 #include "sysc/kernel/sc_object.h"
+#include "sysc/kernel/sc_host_atomic.h"
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
 
 namespace sc_core {
 
+class sc_kernel_task;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel
 //
@@ -223,6 +226,9 @@ private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
     sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+
+    // next entry in the list of external updates (0: not queued)
+    sc_host_atomic<sc_prim_channel*> m_async_next_p;
 };
 
 
@@ -257,6 +263,12 @@ public:
 
     bool pending_async_updates() const;
 
+    // post a task from any host thread (see sc_post_kernel_task())
+    void async_post( sc_kernel_task& );
+
+    // are there newly posted tasks or tasks due at the current time?
+    bool pending_tasks() const;
+
     // synchronization with attached async suspending channels
     //  - potentially blocks the current thread, if no explicitly
     //    attached async channels have posted updates, yet
@@ -279,8 +291,9 @@ private:
     // destructor
     ~sc_prim_channel_registry();
 
-    // called during the update phase of a delta cycle
-    void perform_update();
+    // called during the update phase of a delta cycle,
+    // returns the number of updated channels
+    std::size_t perform_update();
 
     // called when construction is done
     bool construction_done();
@@ -294,6 +307,13 @@ private:
     // called after simulation ends
     void simulation_done();
 
+    // called by request_update() during a parallel evaluation
+    void defer_update( sc_prim_channel& );
+
+    // accepted tasks (not) due at the current time
+    void schedule_task( sc_kernel_task* );
+    void run_tasks();
+
     // disabled
     sc_prim_channel_registry();
     sc_prim_channel_registry( const sc_prim_channel_registry& );
@@ -301,12 +321,16 @@ private:
 
 private:
     class async_update_list;   
+    class timed_task_list;
 
     async_update_list*            m_async_update_list_p; // external updates.
+    timed_task_list*              m_timed_task_list_p;   // accepted tasks.
+    std::size_t                   m_timed_task_count;    // # accepted tasks.
     int                           m_construction_done;   // # of constructs.
     std::vector<sc_prim_channel*> m_prim_channel_vec;    // existing channels.
     sc_simcontext*                m_simc;                // simulator context.
     sc_prim_channel*              m_update_list_p;       // internal updates.
+    bool                          m_defer_updates;       // parallel eval.
 };
 
 
@@ -323,6 +347,10 @@ inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
+    if( SC_UNLIKELY_( m_defer_updates ) ) {
+        defer_update( prim_channel_ );
+        return;
+    }
     prim_channel_.m_update_next_p = m_update_list_p;
     m_update_list_p = &prim_channel_;
 }
@@ -134,12 +134,13 @@ sc_signal_channel::deprecated_trace() const
     }
 }
 
-// create a (kernel) event, if needed
+// create a (kernel) event, if needed, owned by this channel
 sc_event*
 sc_signal_channel::lazy_kernel_event( sc_event** ev, const char* name ) const
 {
     if ( !*ev ) {
         *ev = new sc_event( sc_event::kernel_event, name );
+        (*ev)->m_parent_p = const_cast<sc_signal_channel*>( this );
     }
     return *ev;
 }
@@ -111,6 +111,19 @@ public:
     bool event() const
         { return simcontext()->event_occurred(m_change_stamp); }
 
+    // untyped function pointer, see direct_writer()
+    typedef void (*direct_write_fn)();
+
+    // the current value, if the ports may read it directly instead of
+    // calling read(), 0 otherwise (for internal use only)
+    virtual const void* direct_value() const
+        { return 0; }
+
+    // a function doing the same as write(), if the ports may call it
+    // instead, 0 otherwise (for internal use only)
+    virtual direct_write_fn direct_writer() const
+        { return 0; }
+
 protected:
     void do_update();
 
@@ -213,6 +226,10 @@ public:
     // write the new value
     virtual void write( const T& );
 
+    // direct port access, unless read() or write() may be overridden
+    virtual const void* direct_value() const;
+    virtual direct_write_fn direct_writer() const;
+
 
     // other methods
 
@@ -258,6 +275,9 @@ protected:
     virtual void update();
             void do_update();
 
+private:
+    static void direct_write( sc_signal_channel&, const T& );
+
 protected:
     T m_cur_val;         // current value of object.
     T m_new_val;         // next value of object.
@@ -300,6 +320,37 @@ sc_signal_t<T,POL>::write( const T& value_ )
 }
 
 
+// direct port access: only plain signals qualify, since derived channels
+// may override read() or write()
+
+template< class T, sc_writer_policy POL >
+inline
+const void*
+sc_signal_t<T,POL>::direct_value() const
+{
+    return ( typeid( *this ) == typeid( sc_signal<T,POL> ) ) ? &m_cur_val : 0;
+}
+
+template< class T, sc_writer_policy POL >
+inline
+sc_signal_channel::direct_write_fn
+sc_signal_t<T,POL>::direct_writer() const
+{
+    if( typeid( *this ) != typeid( sc_signal<T,POL> ) )
+        return 0;
+    void (*write_p)( sc_signal_channel&, const T& ) = &this_type::direct_write;
+    return reinterpret_cast<direct_write_fn>( write_p );
+}
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::direct_write( sc_signal_channel& channel_,
+                                  const T& value_ )
+{
+    static_cast<this_type&>( channel_ ).this_type::write( value_ );
+}
+
+
 template< class T, sc_writer_policy POL >
 inline
 void
@@ -556,6 +607,53 @@ private:
     sc_signal( const this_type& ) /* = delete */;
 };
 
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal_direct<T> (implementation-defined)
+//
+//  Direct access of the signal ports to their channel, once the binding is
+//  complete and if enabled by sc_set_direct_port_access().  The ports read
+//  the current value of plain signals and buffers from its storage and
+//  write them via a function pointer to their non-virtual write method.
+//  Other channels are accessed via their interface.
+// ----------------------------------------------------------------------------
+
+template< class T >
+struct sc_signal_direct
+{
+    typedef void (*write_fn)( sc_signal_channel&, const T& );
+
+    // the current value of the channel, 0 if not directly readable
+    static const T* value( sc_interface* if_ )
+    {
+        const sc_signal_channel* channel_p = channel( if_ );
+        if( channel_p == 0 )
+            return 0;
+        return static_cast<const T*>( channel_p->direct_value() );
+    }
+
+    // the write function of the channel, 0 if not directly writable
+    static write_fn writer( sc_interface* if_, sc_signal_channel*& channel_p )
+    {
+        channel_p = channel( if_ );
+        if( channel_p == 0 )
+            return 0;
+        write_fn write_p =
+          reinterpret_cast<write_fn>( channel_p->direct_writer() );
+        if( write_p == 0 )
+            channel_p = 0;
+        return write_p;
+    }
+
+private:
+    static sc_signal_channel* channel( sc_interface* if_ )
+    {
+        if( !sc_get_direct_port_access() )
+            return 0;
+        return dynamic_cast<sc_signal_channel*>( if_ );
+    }
+};
+
 } // namespace sc_core
 
 /*****************************************************************************
@@ -50,6 +50,7 @@ template class SC_API sc_port<sc_signal_inout_if<sc_dt::sc_logic>,1,SC_ONE_OR_MO
 void
 sc_in<bool>::end_of_elaboration()
 {
+    m_direct_value_p = sc_signal_direct<data_type>::value( get_interface() );
     if( m_traces != 0 ) {
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
@@ -132,6 +133,7 @@ sc_in<bool>::vbind( sc_port_base& parent_ )
 void
 sc_in<sc_dt::sc_logic>::end_of_elaboration()
 {
+    m_direct_value_p = sc_signal_direct<data_type>::value( get_interface() );
     if( m_traces != 0 ) {
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
@@ -244,6 +246,9 @@ sc_inout<bool>::initialize( const data_type& value_ )
 void
 sc_inout<bool>::end_of_elaboration()
 {
+    m_direct_value_p = sc_signal_direct<data_type>::value( get_interface() );
+    m_direct_writer =
+      sc_signal_direct<data_type>::writer( get_interface(), m_direct_channel_p );
     if( m_init_val != 0 ) {
 	write( *m_init_val );
 	delete m_init_val;
@@ -335,6 +340,9 @@ sc_inout<sc_dt::sc_logic>::initialize( const data_type& value_ )
 void
 sc_inout<sc_dt::sc_logic>::end_of_elaboration()
 {
+    m_direct_value_p = sc_signal_direct<data_type>::value( get_interface() );
+    m_direct_writer =
+      sc_signal_direct<data_type>::writer( get_interface(), m_direct_channel_p );
     if( m_init_val != 0 ) {
 	write( *m_init_val );
 	delete m_init_val;
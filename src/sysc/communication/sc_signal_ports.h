@@ -32,6 +32,7 @@
 
 #include "sysc/communication/sc_event_finder.h"
 #include "sysc/communication/sc_port.h"
+#include "sysc/communication/sc_signal.h"
 #include "sysc/communication/sc_signal_ifs.h"
 #include "sysc/datatypes/bit/sc_logic.h"
 #include "sysc/tracing/sc_trace.h"
@@ -104,52 +105,62 @@ public:
 
     sc_in()
 	: base_type(), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const char* name_ )
 	: base_type( name_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const in_if_type& interface_ )
         : base_type( const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
         {}
 
     sc_in( const char* name_, const in_if_type& interface_ )
 	: base_type( name_, const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( in_port_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, in_port_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( inout_port_type& parent_ )
 	: base_type(), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( const char* name_, inout_port_type& parent_ )
 	: base_type( name_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( this_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
 
@@ -209,10 +220,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // was there a value changed event?
@@ -268,6 +279,7 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+  const data_type* m_direct_value_p;  // current value of a plain signal.
 
 private:
 
@@ -300,6 +312,8 @@ inline
 void
 sc_in<T>::end_of_elaboration()
 {
+    m_direct_value_p =
+      sc_signal_direct<data_type>::value( this->get_interface() );
     if( m_traces != 0 ) {
 	for( int i = 0; i < (int)m_traces->size(); ++ i ) {
 	    sc_trace_params* p = (*m_traces)[i];
@@ -416,59 +430,70 @@ public:
 
     sc_in()
 	: base_type(), m_traces( 0 ), m_change_finder_p(0),
-	  m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const char* name_ )
 	: base_type( name_ ), m_traces( 0 ), m_change_finder_p(0),
-	  m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const in_if_type& interface_ )
 	: base_type( const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, const in_if_type& interface_ )
 	: base_type( name_, const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( in_port_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, in_port_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( inout_port_type& parent_ )
 	: base_type(), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( const char* name_, inout_port_type& parent_ )
 	: base_type( name_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( this_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
 #if defined(TESTING)
     sc_in( const this_type& parent_ )
 	: base_type( *(in_if_type*)parent_.get_interface() ) , m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 #endif
 
     sc_in( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
 
@@ -540,10 +565,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // use for positive edge sensitivity
@@ -626,6 +651,7 @@ private:
   mutable sc_event_finder* m_change_finder_p;
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
+  const data_type* m_direct_value_p;  // current value of a plain signal.
 
 private:
 
@@ -680,52 +706,62 @@ public:
 
     sc_in()
 	: base_type(), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const char* name_ )
 	: base_type( name_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( const in_if_type& interface_ )
 	: base_type( const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, const in_if_type& interface_ )
 	: base_type( name_, const_cast<in_if_type&>( interface_ ) ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( in_port_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, in_port_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     explicit sc_in( inout_port_type& parent_ )
 	: base_type(), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( const char* name_, inout_port_type& parent_ )
 	: base_type( name_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{ sc_port_base::bind( parent_ ); }
 
     sc_in( this_type& parent_ )
 	: base_type( parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
     sc_in( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 )
 	{}
 
 
@@ -797,10 +833,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // use for positive edge sensitivity
@@ -883,6 +919,7 @@ private:
   mutable sc_event_finder* m_change_finder_p;
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
+  const data_type* m_direct_value_p;  // current value of a plain signal.
 
 private:
 
@@ -931,42 +968,58 @@ public:
 
     sc_inout()
 	: base_type(), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( const char* name_ )
 	: base_type( name_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_if_type& interface_ )
 	: base_type( interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_if_type& interface_ )
 	: base_type( name_, interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_port_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_port_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( this_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0)
+	  m_change_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
 
@@ -992,10 +1045,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // was there a value changed event?
@@ -1007,22 +1060,27 @@ public:
     // write the new value
 
     void write( const data_type& value_ )
-	{ (*this)->write( value_ ); }
+	{
+	    if( m_direct_writer != 0 )
+	        m_direct_writer( *m_direct_channel_p, value_ );
+	    else
+	        (*this)->write( value_ );
+	}
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_.read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1070,6 +1128,10 @@ protected:
 
 private:
   mutable sc_event_finder* m_change_finder_p;
+  typedef typename sc_signal_direct<data_type>::write_fn direct_write_fn;
+  const data_type*   m_direct_value_p;   // current value of a plain signal.
+  sc_signal_channel* m_direct_channel_p; // plain signal to write directly.
+  direct_write_fn    m_direct_writer;    // its write method.
 
 private:
 
@@ -1132,6 +1194,10 @@ inline
 void
 sc_inout<T>::end_of_elaboration()
 {
+    m_direct_value_p =
+      sc_signal_direct<data_type>::value( this->get_interface() );
+    m_direct_writer = sc_signal_direct<data_type>::writer(
+      this->get_interface(), m_direct_channel_p );
     if( m_init_val != 0 ) {
 	write( *m_init_val );
 	delete m_init_val;
@@ -1221,42 +1287,58 @@ public:
 
     sc_inout()
 	: base_type(), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( const char* name_ )
 	: base_type( name_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_if_type& interface_ )
 	: base_type( interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_if_type& interface_ )
 	: base_type( name_, interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_port_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_port_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( this_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
 
@@ -1292,10 +1374,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // use for positive edge sensitivity
@@ -1333,22 +1415,27 @@ public:
     // write the new value
 
     void write( const data_type& value_ )
-	{ (*this)->write( value_ ); }
+	{
+	    if( m_direct_writer != 0 )
+	        m_direct_writer( *m_direct_channel_p, value_ );
+	    else
+	        (*this)->write( value_ );
+	}
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_.read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1398,6 +1485,10 @@ private:
   mutable sc_event_finder* m_change_finder_p;
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
+  typedef sc_signal_direct<data_type>::write_fn direct_write_fn;
+  const data_type*   m_direct_value_p;   // current value of a plain signal.
+  sc_signal_channel* m_direct_channel_p; // plain signal to write directly.
+  direct_write_fn    m_direct_writer;    // its write method.
 
 private:
 
@@ -1447,42 +1538,58 @@ public:
 
     sc_inout()
 	: base_type(), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( const char* name_ )
 	: base_type( name_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_if_type& interface_ )
 	: base_type( interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_if_type& interface_ )
 	: base_type( name_, interface_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     explicit sc_inout( inout_port_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, inout_port_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( this_type& parent_ )
 	: base_type( parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
     sc_inout( const char* name_, this_type& parent_ )
 	: base_type( name_, parent_ ), m_init_val( 0 ), m_traces( 0 ),
-	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0)
+	  m_change_finder_p(0), m_neg_finder_p(0), m_pos_finder_p(0),
+	  m_direct_value_p( 0 ),
+	  m_direct_channel_p( 0 ), m_direct_writer( 0 )
 	{}
 
 
@@ -1518,10 +1625,10 @@ public:
     // read the current value
 
     const data_type& read() const
-	{ return (*this)->read(); }
+	{ return m_direct_value_p ? *m_direct_value_p : (*this)->read(); }
 
     operator const data_type& () const
-	{ return (*this)->read(); }
+	{ return read(); }
 
 
     // use for positive edge sensitivity
@@ -1559,22 +1666,27 @@ public:
     // write the new value
 
     void write( const data_type& value_ )
-	{ (*this)->write( value_ ); }
+	{
+	    if( m_direct_writer != 0 )
+	        m_direct_writer( *m_direct_channel_p, value_ );
+	    else
+	        (*this)->write( value_ );
+	}
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ write( port_.read() ); return *this; }
 
 
     // set initial value (can also be called when port is not bound yet)
@@ -1624,6 +1736,10 @@ private:
   mutable sc_event_finder* m_change_finder_p;
   mutable sc_event_finder* m_neg_finder_p;
   mutable sc_event_finder* m_pos_finder_p;
+  typedef sc_signal_direct<data_type>::write_fn direct_write_fn;
+  const data_type*   m_direct_value_p;   // current value of a plain signal.
+  sc_signal_channel* m_direct_channel_p; // plain signal to write directly.
+  direct_write_fn    m_direct_writer;    // its write method.
 
 private:
 
@@ -1713,19 +1829,19 @@ public:
     // write the new value
 
     this_type& operator = ( const data_type& value_ )
-	{ (*this)->write( value_ ); return *this; }
+	{ this->write( value_ ); return *this; }
 
     this_type& operator = ( const in_if_type& interface_ )
-	{ (*this)->write( interface_.read() ); return *this; }
+	{ this->write( interface_.read() ); return *this; }
 
     this_type& operator = ( const in_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_->read() ); return *this; }
 
     this_type& operator = ( const inout_port_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_->read() ); return *this; }
 
     this_type& operator = ( const this_type& port_ )
-	{ (*this)->write( port_->read() ); return *this; }
+	{ this->write( port_.read() ); return *this; }
 
     virtual const char* kind() const
         { return "sc_out"; }
@@ -110,7 +110,7 @@ public:
     const T*& value_ptr();
 
 private:
-    static sc_global<T>* m_instance;
+    static SC_CONTEXT_LOCAL_ sc_global<T>* m_instance;
 
     sc_core::sc_phash<void*,const T*> m_map;
     void*                             m_proc; // context (current process or NULL)
@@ -174,7 +174,7 @@ private:
 // ----------------------------------------------------------------------------
 
 template <class T>
-sc_global<T>* sc_global<T>::m_instance = 0;
+SC_CONTEXT_LOCAL_ sc_global<T>* sc_global<T>::m_instance = 0;
 
 template <class T>
 inline
@@ -206,8 +206,9 @@ sc_global<T>::update()
 }
 
 
+// not inline, to keep the (thread-local) instance within the library
+// for the explicitly instantiated variants
 template <class T>
-inline
 sc_global<T>*
 sc_global<T>::instance()
 {
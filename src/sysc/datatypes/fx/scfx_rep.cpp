@@ -81,7 +81,7 @@ namespace sc_dt
 //  some utilities
 // ----------------------------------------------------------------------------
 
-static scfx_pow10 pow10_fx;
+static SC_CONTEXT_LOCAL_ scfx_pow10 pow10_fx;
 
 static const int mantissa0_size = SCFX_IEEE_DOUBLE_M_SIZE - bits_in_int;
 
@@ -369,7 +369,7 @@ union scfx_rep_node
 };
 
 
-static scfx_rep_node* list = 0;
+static SC_CONTEXT_LOCAL_ scfx_rep_node* list = 0;
 
 
 void*
@@ -1260,7 +1260,7 @@ const char*
 scfx_rep::to_string( sc_numrep numrep, int w_prefix,
 		     sc_fmt fmt, const scfx_params* params ) const
 {
-    static scfx_string s;
+    static SC_CONTEXT_LOCAL_ scfx_string s;
 
     s.clear();
 
@@ -102,7 +102,7 @@ sc_int_concref_invalid_length( int length )
 //  Proxy class for sc_int bit selection (r-value and l-value).
 // ----------------------------------------------------------------------------
 
-sc_core::sc_vpool<sc_int_bitref> sc_int_bitref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_int_bitref> sc_int_bitref::m_pool(9);
 
 // concatenation methods:
 
@@ -267,7 +267,7 @@ bool sc_int_subref_r::concat_get_data( sc_digit* dst_p, int low_i ) const
 //  Proxy class for sc_int part selection (r-value and l-value).
 // ----------------------------------------------------------------------------
 
-sc_core::sc_vpool<sc_int_subref> sc_int_subref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_int_subref> sc_int_subref::m_pool(9);
 
 // assignment operators
 
@@ -301,7 +301,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 public:
-    static sc_core::sc_vpool<sc_int_bitref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_int_bitref> m_pool;
 
 };
 
@@ -524,7 +524,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 public:
-    static sc_core::sc_vpool<sc_int_subref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_int_subref> m_pool;
 
 };
 
@@ -102,8 +102,8 @@ namespace sc_dt {
 
 // Pool of temporary instances:
 
-sc_core::sc_vpool<sc_signed_bitref> sc_signed_bitref::m_pool(9);
-sc_core::sc_vpool<sc_signed_subref> sc_signed_subref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_signed_bitref> sc_signed_bitref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_signed_subref> sc_signed_subref::m_pool(9);
 
 void sc_signed::invalid_init( const char* type_name, int nb ) const
 {
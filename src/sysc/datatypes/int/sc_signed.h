@@ -882,7 +882,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_signed_bitref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_signed_bitref> m_pool;
 };
 
 
@@ -1076,7 +1076,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_signed_subref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_signed_subref> m_pool;
 };
 
 
@@ -293,7 +293,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_uint_bitref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_uint_bitref> m_pool;
 
 };
 
@@ -510,7 +510,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_uint_subref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_uint_subref> m_pool;
 
 };
 
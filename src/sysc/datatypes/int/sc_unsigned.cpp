@@ -108,9 +108,9 @@ namespace sc_dt
 //   The sc_unsigned pool is used by the concatenation support.
 //   The bit and part reference pools allow references to be returned.
 
-sc_core::sc_vpool<sc_unsigned> sc_unsigned::m_pool(8);
-sc_core::sc_vpool<sc_unsigned_bitref> sc_unsigned_bitref::m_pool(9);
-sc_core::sc_vpool<sc_unsigned_subref> sc_unsigned_subref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned> sc_unsigned::m_pool(8);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned_bitref> sc_unsigned_bitref::m_pool(9);
+SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned_subref> sc_unsigned_subref::m_pool(9);
 
 
 void sc_unsigned::invalid_init( const char* type_name, int nb ) const
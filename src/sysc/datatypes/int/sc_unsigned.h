@@ -788,7 +788,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_unsigned_bitref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned_bitref> m_pool;
 };
 
 
@@ -978,7 +978,7 @@ public:
     void scan( ::std::istream& is = ::std::cin );
 
 protected:
-    static sc_core::sc_vpool<sc_unsigned_subref> m_pool;
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned_subref> m_pool;
 };
 
 
@@ -1955,7 +1955,7 @@ public:
                                          const sc_digit *vd);
 
 public:
-  static sc_core::sc_vpool<sc_unsigned> m_pool;
+  static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_unsigned> m_pool;
 
 private:
 
@@ -52,11 +52,11 @@
 namespace sc_core {
     template class SC_API sc_vpool<sc_dt::sc_concatref>;
     template class SC_API sc_vpool<sc_dt::sc_concat_bool>;
-    sc_byte_heap             sc_temp_heap(0x300000);
+    SC_CONTEXT_LOCAL_ sc_byte_heap sc_temp_heap(0x300000);
 } // namespace sc_core
 
 namespace sc_dt {
-    sc_core::sc_vpool<sc_concat_bool> sc_concat_bool::m_pool(9);
-    sc_core::sc_vpool<sc_concatref>   sc_concatref::m_pool(9);
+    SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_concat_bool> sc_concat_bool::m_pool(9);
+    SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_concatref>   sc_concatref::m_pool(9);
 } // namespace sc_dt
 
@@ -96,7 +96,7 @@ class sc_concat_bool;
 } // namespace sc_dt
 
 namespace sc_core {
-extern sc_byte_heap SC_API sc_temp_heap; // Temporary storage.
+extern sc_byte_heap SC_API SC_CONTEXT_LOCAL_ sc_temp_heap; // Temporary storage.
 
 // explicit template instantiations
 SC_API_TEMPLATE_DECL_ sc_vpool<sc_dt::sc_concatref>;
@@ -449,7 +449,7 @@ public:
     } 
 
 public:
-    static sc_core::sc_vpool<sc_concatref> m_pool; // Pool of temporary objects.
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_concatref> m_pool; // Pool of temporary objects.
 
 public:
     enum concat_flags {
@@ -619,7 +619,7 @@ operator >> ( ::std::istream& is, sc_concatref& a )
 class SC_API sc_concat_bool : public sc_value_base
 {
   protected:
-    static sc_core::sc_vpool<sc_concat_bool> m_pool;  // Temporaries pool.
+    static SC_CONTEXT_LOCAL_ sc_core::sc_vpool<sc_concat_bool> m_pool;  // Temporaries pool.
     bool                                     m_value; // Value for this obj.
 
   public:
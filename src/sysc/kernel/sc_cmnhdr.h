@@ -184,6 +184,24 @@
 
 #endif // SC_WIN_DLL
 
+// ----------------------------------------------------------------------------
+// storage of the "current" simulation context and of the state tied to it
+// (report handler settings, datatype temporaries), per host thread with
+// SC_ENABLE_THREAD_LOCAL_CONTEXTS
+
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+# if SC_CPLUSPLUS < 201103L
+#   error SC_ENABLE_THREAD_LOCAL_CONTEXTS requires C++11 or later
+# elif defined(SC_WIN_DLL) && (defined(_WIN32) || defined(_WIN64))
+#   error SC_ENABLE_THREAD_LOCAL_CONTEXTS is not supported for SystemC DLLs
+# elif defined(SC_USE_PTHREADS)
+#   error SC_ENABLE_THREAD_LOCAL_CONTEXTS is not supported with SC_USE_PTHREADS
+# endif
+# define SC_CONTEXT_LOCAL_ thread_local
+#else
+# define SC_CONTEXT_LOCAL_ /* nothing */
+#endif // SC_ENABLE_THREAD_LOCAL_CONTEXTS
+
 #if defined(SC_BUILD) && defined(_MSC_VER)
 // always instantiate during Windows library build
 # define SC_API_TEMPLATE_DECL_ template class SC_API
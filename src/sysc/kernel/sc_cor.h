@@ -48,6 +48,15 @@ class sc_simcontext;
 typedef void (sc_cor_fn)( void* );
 
 
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_cor_pagesize
+//
+//  Page size of the host, the unit of coroutine stacks and guard pages.
+// ----------------------------------------------------------------------------
+
+extern std::size_t sc_cor_pagesize();
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor
 //
@@ -69,6 +78,9 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool /* enable */ ) {}
 
+    // high-water mark of the stack in bytes, 0 if not measured
+    virtual std::size_t stack_usage() const { return 0; }
+
 private:
 
     // disabled
@@ -107,6 +119,15 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main() = 0;
 
+    // options of reserve_stacks()
+    enum { STACK_ARENA_GUARD_PAGES = 1, STACK_ARENA_HUGE_PAGES = 2 };
+
+    // reserve a single memory region for the stacks of the coroutines
+    // created next (count stacks of size bytes in total), if supported
+    virtual void reserve_stacks( std::size_t /* size */,
+                                 std::size_t /* count */,
+                                 int /* options */ ) {}
+
     // get the simulation context
     sc_simcontext* simcontext()
         { return m_simc; }
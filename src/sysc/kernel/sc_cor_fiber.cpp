@@ -51,10 +51,10 @@ namespace sc_core {
 
 // main coroutine
 
-static sc_cor_fiber main_cor;
+static SC_CONTEXT_LOCAL_ sc_cor_fiber main_cor;
 #if defined(__GNUC__) && __USING_SJLJ_EXCEPTIONS__
 // current coroutine
-static sc_cor_fiber* curr_cor;
+static SC_CONTEXT_LOCAL_ sc_cor_fiber* curr_cor;
 #endif
 
 
@@ -82,7 +82,7 @@ sc_cor_fiber::~sc_cor_fiber()
 //  Coroutine package class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
-int sc_cor_pkg_fiber::instance_count = 0;
+SC_CONTEXT_LOCAL_ int sc_cor_pkg_fiber::instance_count = 0;
 
 
 // constructor
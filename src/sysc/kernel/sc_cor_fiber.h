@@ -125,7 +125,7 @@ class SC_API sc_cor_pkg_fiber
 
 private:
 
-    static int instance_count;
+    static SC_CONTEXT_LOCAL_ int instance_count;
 
 private:
 
@@ -48,11 +48,117 @@ namespace sc_core {
 
 // main coroutine
 
-static sc_cor_qt main_cor;
+static SC_CONTEXT_LOCAL_ sc_cor_qt main_cor;
 
 // current coroutine
 
-static sc_cor_qt* curr_cor = 0;
+static SC_CONTEXT_LOCAL_ sc_cor_qt* curr_cor = 0;
+
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+//  Stack recycling
+//
+//  Stacks of deleted coroutines are kept for reuse by coroutines with the
+//  same stack size, e.g. for the short-lived thread processes spawned per
+//  transaction by many TLM models.  This avoids a pair of mmap()/munmap()
+//  system calls per spawned process.  The cache is bounded and released
+//  with the last coroutine package.
+// ----------------------------------------------------------------------------
+
+#ifndef SC_LEGACY_MEM_MGMT
+
+static const int stack_cache_max = 64;
+
+static SC_CONTEXT_LOCAL_ bool        stack_cache_enabled = false;
+static SC_CONTEXT_LOCAL_ int         stack_cache_count   = 0;
+static SC_CONTEXT_LOCAL_ void*       stack_cache[stack_cache_max];
+static SC_CONTEXT_LOCAL_ std::size_t stack_cache_size[stack_cache_max];
+
+// take a cached stack of the given size, 0 if there is none
+static void* stack_cache_take( std::size_t stack_size )
+{
+    for( int i = stack_cache_count - 1; i >= 0; --i ) {
+        if( stack_cache_size[i] == stack_size ) {
+            void* stack = stack_cache[i];
+            --stack_cache_count;
+            stack_cache[i]      = stack_cache[stack_cache_count];
+            stack_cache_size[i] = stack_cache_size[stack_cache_count];
+            return stack;
+        }
+    }
+    return 0;
+}
+
+// keep a stack for reuse, false if the cache is full or disabled
+static bool stack_cache_put( void* stack, std::size_t stack_size )
+{
+    if( !stack_cache_enabled || stack_cache_count == stack_cache_max )
+        return false;
+
+    stack_cache[stack_cache_count]      = stack;
+    stack_cache_size[stack_cache_count] = stack_size;
+    ++stack_cache_count;
+    return true;
+}
+
+static void stack_cache_release()
+{
+    while( stack_cache_count > 0 ) {
+        --stack_cache_count;
+        ::munmap( stack_cache[stack_cache_count],
+                  stack_cache_size[stack_cache_count] );
+    }
+}
+
+#endif // SC_LEGACY_MEM_MGMT
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_cor_qt_arena
+//
+//  Single memory reservation, which the stacks of the thread processes
+//  known at the end of elaboration are carved out of (see reserve_stacks).
+//  Compared to a mapping per stack, this saves the system calls and, without
+//  guard pages, the kernel's per-mapping bookkeeping (vm.max_map_count).
+//  The reservation is released together with the last of its stacks after
+//  the coroutine package has been destroyed.
+// ----------------------------------------------------------------------------
+
+struct sc_cor_qt_arena
+{
+    void*       base;        // start of the reservation
+    std::size_t size;        // size of the reservation
+    std::size_t used;        // bytes handed out so far
+    std::size_t stacks;      // number of live stacks in the arena
+    bool        guard_pages; // protect the end of each stack
+    bool        orphaned;    // the owning package has been destroyed
+
+    // hand out a stack, 0 if the arena is exhausted
+    void* take( std::size_t stack_size )
+    {
+        if( orphaned || size - used < stack_size )
+            return 0;
+        void* stack = static_cast<char*>( base ) + used;
+        used += stack_size;
+        ++stacks;
+        return stack;
+    }
+
+    // return a stack, release the arena with its last stack
+    void give_back()
+    {
+        if( --stacks == 0 && orphaned )
+            release();
+    }
+
+    void release()
+    {
+#ifndef SC_LEGACY_MEM_MGMT
+        ::munmap( base, size );
+#endif
+        delete this;
+    }
+};
 
 // ----------------------------------------------------------------------------
 
@@ -78,24 +184,6 @@ static void __sanitizer_finish_switch_cor_qt() {
     }
 }
 
-// ----------------------------------------------------------------------------
-
-static std::size_t sc_pagesize()
-{
-    static std::size_t pagesize = 0;
-
-    if( pagesize == 0 ) {
-#     if defined(__ppc__)
-        pagesize = getpagesize();
-#     else
-        pagesize = sysconf( _SC_PAGESIZE );
-#     endif
-    }
-
-    sc_assert( pagesize != 0 );
-    return pagesize;
-}
-
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_qt
 //
@@ -104,15 +192,49 @@ static std::size_t sc_pagesize()
 
 sc_cor_qt::~sc_cor_qt()
 {
+    if( m_arena ) {
+        m_arena->give_back();
+        return;
+    }
 #ifdef SC_LEGACY_MEM_MGMT
     std::free( m_stack );
 #else
-    if ( m_stack ) {
+    if ( m_stack && !stack_cache_put( m_stack, m_stack_size ) ) {
         ::munmap( m_stack, m_stack_size );
     }
 #endif
 }
 
+// pattern filling the stacks while stack profiling is enabled
+
+static const unsigned char stack_paint_pattern = 0xa5;
+
+// high-water mark of a painted stack
+
+std::size_t
+sc_cor_qt::stack_usage() const
+{
+    if( !m_painted )
+        return 0;
+
+    // skip the guard page, which may be protected
+    const std::size_t pagesize = sc_cor_pagesize();
+    const unsigned char* begin = static_cast<const unsigned char*>(m_stack);
+    const unsigned char* end   = begin + m_stack_size;
+
+#ifdef QUICKTHREADS_GROW_DOWN
+    const unsigned char* p = begin + pagesize;
+    while( p != end && *p == stack_paint_pattern )
+        ++p;
+    return end - p;
+#else
+    const unsigned char* p = end - pagesize;
+    while( p != begin && *(p - 1) == stack_paint_pattern )
+        --p;
+    return p - begin;
+#endif
+}
+
 // switch stack protection on/off
 
 void
@@ -121,7 +243,11 @@ sc_cor_qt::stack_protect( bool enable )
     // Code needs to be tested on HP-UX and disabled if it doesn't work there
     // Code still needs to be ported to WIN32
 
-    const std::size_t pagesize = sc_pagesize();
+    if( m_arena && !m_arena->guard_pages ) {
+        return;
+    }
+
+    const std::size_t pagesize = sc_cor_pagesize();
     sc_assert( m_stack_size > ( 2 * pagesize ) );
 
     std::size_t sp_addr = reinterpret_cast<std::size_t>(m_stack);
@@ -182,7 +308,7 @@ sc_cor_qt::stack_protect( bool enable )
 //  Coroutine package class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
-int sc_cor_pkg_qt::instance_count = 0;
+SC_CONTEXT_LOCAL_ int sc_cor_pkg_qt::instance_count = 0;
 
 // support functions
 
@@ -190,7 +316,7 @@ int sc_cor_pkg_qt::instance_count = 0;
 static inline void*
 stack_alloc( void** buf, std::size_t* stack_size )
 {
-    const std::size_t alignment     = sc_pagesize();
+    const std::size_t alignment     = sc_cor_pagesize();
     const std::size_t round_up_mask = alignment - 1;
     sc_assert( 0 == ( alignment & round_up_mask ) ); // power of 2
     sc_assert( buf );
@@ -227,12 +353,15 @@ stack_alloc( void** buf, std::size_t* stack_size )
 // constructor
 
 sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
-: sc_cor_pkg( simc )
+: sc_cor_pkg( simc ), m_arena( 0 )
 {
     if( ++ instance_count == 1 ) {
 	// initialize the current coroutine
 	sc_assert( curr_cor == 0 );
 	curr_cor = &main_cor;
+#ifndef SC_LEGACY_MEM_MGMT
+        stack_cache_enabled = true;
+#endif
     }
 }
 
@@ -241,9 +370,18 @@ sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
 
 sc_cor_pkg_qt::~sc_cor_pkg_qt()
 {
+    if( m_arena ) {
+        m_arena->orphaned = true;
+        if( m_arena->stacks == 0 )
+            m_arena->release();
+    }
     if( -- instance_count == 0 ) {
 	// cleanup the current coroutine
 	curr_cor = 0;
+#ifndef SC_LEGACY_MEM_MGMT
+        stack_cache_enabled = false;
+        stack_cache_release();
+#endif
     }
 }
 
@@ -267,13 +405,32 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
     cor->m_pkg = this;
     cor->m_stack_size = stack_size;
 
-    void* aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
+    void* aligned_sp = NULL;
+#ifndef SC_LEGACY_MEM_MGMT
+    const std::size_t round_up_mask = sc_cor_pagesize() - 1;
+    cor->m_stack_size = (stack_size + round_up_mask) & ~round_up_mask;
+    if( m_arena ) {
+        aligned_sp = cor->m_stack = m_arena->take( cor->m_stack_size );
+        if( aligned_sp )
+            cor->m_arena = m_arena;
+    }
+    if( aligned_sp == NULL )
+        aligned_sp = cor->m_stack = stack_cache_take( cor->m_stack_size );
+#endif
+    if( aligned_sp == NULL )
+        aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
     if( aligned_sp == NULL )
     {
         SC_REPORT_ERROR( SC_ID_STACK_SETUP_FAILED_
                        , "failed to allocate stack memory" );
         sc_abort();
     }
+    // painting touches, i.e. commits every page of the stack: while
+    // profiling, the resident memory grows by the full size of all stacks
+    if( simcontext()->get_stack_profiler() != 0 ) {
+        std::memset( cor->m_stack, stack_paint_pattern, cor->m_stack_size );
+        cor->m_painted = true;
+    }
     cor->m_sp = QUICKTHREADS_SP( aligned_sp, cor->m_stack_size );
     cor->m_sp = QUICKTHREADS_ARGS( cor->m_sp, arg, cor, (qt_userf_t*) fn,
                                    sc_cor_qt_wrapper );
@@ -330,6 +487,54 @@ sc_cor_pkg_qt::get_main()
     return &main_cor;
 }
 
+
+// reserve a single memory region for the stacks created next
+
+void
+sc_cor_pkg_qt::reserve_stacks( std::size_t size, std::size_t count,
+                               int options )
+{
+#ifndef SC_LEGACY_MEM_MGMT
+    if( m_arena ) { // stop handing out stacks from the previous arena
+        m_arena->orphaned = true;
+        if( m_arena->stacks == 0 )
+            m_arena->release();
+        m_arena = 0;
+    }
+    if( count == 0 )
+        return;
+
+    // allow for rounding each stack up to full pages
+    const std::size_t pagesize = sc_cor_pagesize();
+    size = ( size + pagesize - 1 ) / pagesize * pagesize + count * pagesize;
+
+    int flags = MAP_PRIVATE | MAP_ANON;
+#   if defined(MAP_NORESERVE)
+        flags |= MAP_NORESERVE; // commit pages on first use only
+#   endif
+    void* base = ::mmap( NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0 );
+    if( base == MAP_FAILED ) { // fall back to a mapping per stack
+        SC_REPORT_WARNING( SC_ID_STACK_SETUP_FAILED_,
+                           "stack arena unavailable" );
+        return;
+    }
+#   if defined(MADV_HUGEPAGE)
+        if( options & STACK_ARENA_HUGE_PAGES )
+            ::madvise( base, size, MADV_HUGEPAGE );
+#   endif
+
+    m_arena = new sc_cor_qt_arena;
+    m_arena->base        = base;
+    m_arena->size        = size;
+    m_arena->used        = 0;
+    m_arena->stacks      = 0;
+    m_arena->guard_pages = ( options & STACK_ARENA_GUARD_PAGES ) != 0;
+    m_arena->orphaned    = false;
+#else
+    (void)size; (void)count; (void)options;
+#endif // SC_LEGACY_MEM_MGMT
+}
+
 } // namespace sc_core
 
 #endif
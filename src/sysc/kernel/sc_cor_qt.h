@@ -39,6 +39,7 @@
 namespace sc_core {
 
 class sc_cor_pkg_qt;
+struct sc_cor_qt_arena;
 typedef sc_cor_pkg_qt sc_cor_pkg_t;
 
 // ----------------------------------------------------------------------------
@@ -55,6 +56,7 @@ public:
     // constructor
     sc_cor_qt()
 	: m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_pkg( 0 )
+	, m_painted( false ), m_arena( 0 )
 	{}
 
     // destructor
@@ -63,6 +65,9 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool enable );
 
+    // high-water mark of a painted stack
+    virtual std::size_t stack_usage() const;
+
 public:
 
     std::size_t    m_stack_size;  // stack size
@@ -71,6 +76,9 @@ public:
 
     sc_cor_pkg_qt* m_pkg;         // the creating coroutine package
 
+    bool           m_painted;     // stack filled with the paint pattern
+    sc_cor_qt_arena* m_arena;     // arena of the stack, if any
+
 private:
 
     // disabled
@@ -108,9 +116,15 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main();
 
+    // reserve a single memory region for the stacks created next
+    virtual void reserve_stacks( std::size_t size, std::size_t count,
+                                 int options );
+
 private:
 
-    static int instance_count;
+    static SC_CONTEXT_LOCAL_ int instance_count;
+
+    sc_cor_qt_arena* m_arena; // stack arena of this package, if any
 
 private:
 
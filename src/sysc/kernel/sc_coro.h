@@ -0,0 +1,401 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coro.h -- Stackless coroutine processes (C++20)
+
+  An SC_CORO process is a member function returning sc_coro, which is a
+  C++20 coroutine.  Instead of calling wait(), it suspends itself with
+  co_await co_wait(...), which accepts the arguments of next_trigger():
+
+      sc_coro producer()
+      {
+          for( int i = 0; i < 10; ++i ) {
+              data.write( i );
+              co_await co_wait( 10, SC_NS );
+          }
+      }
+
+  The coroutine is executed by a method process, whose activations resume
+  the coroutine until its next co_await.  Hence, a coroutine process needs
+  neither a stack of its own nor a context switch: its state is kept in a
+  coroutine frame of typically a few hundred bytes, which is recycled via a
+  pool, and it is scheduled like any other method process.  The process
+  terminates, when the coroutine returns.
+
+  Like a method process, a coroutine process shall not call wait().  Unlike
+  a thread process, it is not restarted by a reset.  Coroutine processes
+  are available, if SystemC and the model are compiled with C++20.
+
+ *****************************************************************************/
+
+#ifndef SC_CORO_H_INCLUDED_
+#define SC_CORO_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 202002L && defined(__cpp_impl_coroutine)
+# define SC_HAS_COROUTINES_ 1
+#endif
+
+#if defined(SC_HAS_COROUTINES_)
+
+#include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <coroutine>
+#include <exception>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_frame_pool
+//
+//  Recycles the frames of coroutine processes per size class.  Released
+//  frames are kept on the free lists and never returned to the heap, so
+//  the pool of a simulator thread grows to the largest number of frames
+//  of a size class alive at the same time, e.g., one per coroutine process
+//  in a design without dynamic processes.
+// ----------------------------------------------------------------------------
+
+class sc_coro_frame_pool
+{
+public:
+
+    static void* allocate( std::size_t size )
+    {
+        std::size_t index = size_class( size );
+        if( index >= class_count )
+            return ::operator new( size );
+
+        free_cell*& head = free_list( index );
+        if( head == 0 )
+            return ::operator new( ( index + 1 ) * granularity );
+
+        free_cell* cell = head;
+        head = cell->next;
+        return cell;
+    }
+
+    static void release( void* p, std::size_t size )
+    {
+        std::size_t index = size_class( size );
+        if( index >= class_count ) {
+            ::operator delete( p );
+            return;
+        }
+
+        free_cell* cell = static_cast<free_cell*>( p );
+        cell->next = free_list( index );
+        free_list( index ) = cell;
+    }
+
+private:
+
+    struct free_cell { free_cell* next; };
+
+    static const std::size_t granularity = 64;  // size classes in bytes
+    static const std::size_t class_count = 32;  // largest pooled: 2 KiB
+
+    static std::size_t size_class( std::size_t size )
+        { return ( size + granularity - 1 ) / granularity - 1; }
+
+    // the free lists of the simulator thread (see sc_simcontext)
+    static free_cell*& free_list( std::size_t index )
+    {
+        static SC_CONTEXT_LOCAL_ free_cell* lists[class_count];
+        return lists[index];
+    }
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro
+//
+//  Return type of the member functions of coroutine processes.
+// ----------------------------------------------------------------------------
+
+class sc_coro
+{
+public:
+
+    struct promise_type
+    {
+        sc_coro get_return_object()
+            { return sc_coro( handle_type::from_promise( *this ) ); }
+
+        // the process starts the coroutine at its first activation
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+
+        void unhandled_exception()
+            { m_exception = std::current_exception(); }
+
+        static void* operator new( std::size_t size )
+            { return sc_coro_frame_pool::allocate( size ); }
+
+        static void operator delete( void* p, std::size_t size )
+            { sc_coro_frame_pool::release( p, size ); }
+
+        std::exception_ptr m_exception; // escaped from the coroutine.
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    sc_coro() : m_handle() {}
+
+    sc_coro( sc_coro&& other ) noexcept : m_handle( other.m_handle )
+        { other.m_handle = handle_type(); }
+
+    sc_coro& operator = ( sc_coro&& other ) noexcept
+    {
+        if( this != &other ) {
+            if( m_handle )
+                m_handle.destroy();
+            m_handle = other.m_handle;
+            other.m_handle = handle_type();
+        }
+        return *this;
+    }
+
+    ~sc_coro()
+    {
+        if( m_handle )
+            m_handle.destroy();
+    }
+
+    // is there a coroutine?
+    explicit operator bool() const
+        { return static_cast<bool>( m_handle ); }
+
+    // has the coroutine returned?
+    bool done() const
+        { return m_handle.done(); }
+
+    // execute the coroutine until its next co_await or its end
+    void resume()
+        { m_handle.resume(); }
+
+    std::exception_ptr exception() const
+        { return m_handle.promise().m_exception; }
+
+private:
+
+    explicit sc_coro( handle_type handle ) : m_handle( handle ) {}
+
+    handle_type m_handle;
+
+private:
+    // disabled
+    sc_coro( const sc_coro& );
+    sc_coro& operator = ( const sc_coro& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_trigger
+//
+//  Awaitable returned by co_wait(), sets the next trigger of the process.
+// ----------------------------------------------------------------------------
+
+class sc_coro_trigger
+{
+public:
+
+    sc_coro_trigger()
+      : m_time(), m_timed( false ), m_event_p( 0 ), m_or_list_p( 0 )
+      , m_and_list_p( 0 )
+    {}
+
+    explicit sc_coro_trigger( const sc_time& t )
+      : m_time( t ), m_timed( true ), m_event_p( 0 ), m_or_list_p( 0 )
+      , m_and_list_p( 0 )
+    {}
+
+    sc_coro_trigger& operator()( const sc_event& e )
+        { m_event_p = &e; return *this; }
+    sc_coro_trigger& operator()( const sc_event_or_list& el )
+        { m_or_list_p = &el; return *this; }
+    sc_coro_trigger& operator()( const sc_event_and_list& el )
+        { m_and_list_p = &el; return *this; }
+
+    bool await_ready() const noexcept
+        { return false; }
+
+    void await_suspend( std::coroutine_handle<> ) const
+    {
+        if( m_timed ) {
+            if( m_event_p )         next_trigger( m_time, *m_event_p );
+            else if( m_or_list_p )  next_trigger( m_time, *m_or_list_p );
+            else if( m_and_list_p ) next_trigger( m_time, *m_and_list_p );
+            else                    next_trigger( m_time );
+        } else {
+            if( m_event_p )         next_trigger( *m_event_p );
+            else if( m_or_list_p )  next_trigger( *m_or_list_p );
+            else if( m_and_list_p ) next_trigger( *m_and_list_p );
+            // else: static sensitivity
+        }
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    sc_time                   m_time;       // timeout.
+    bool                      m_timed;      // m_time is set.
+    const sc_event*           m_event_p;    // event to wait for.
+    const sc_event_or_list*   m_or_list_p;  // events to wait for.
+    const sc_event_and_list*  m_and_list_p; // events to wait for.
+};
+
+//------------------------------------------------------------------------------
+//"co_wait"
+//
+// These functions return an awaitable, which suspends a coroutine process
+// until the given trigger.  The arguments are those of next_trigger(),
+// without arguments the process waits for its static sensitivity.
+//------------------------------------------------------------------------------
+inline sc_coro_trigger co_wait()
+    { return sc_coro_trigger(); }
+inline sc_coro_trigger co_wait( const sc_event& e )
+    { return sc_coro_trigger()( e ); }
+inline sc_coro_trigger co_wait( const sc_event_or_list& el )
+    { return sc_coro_trigger()( el ); }
+inline sc_coro_trigger co_wait( const sc_event_and_list& el )
+    { return sc_coro_trigger()( el ); }
+inline sc_coro_trigger co_wait( const sc_time& t )
+    { return sc_coro_trigger( t ); }
+inline sc_coro_trigger co_wait( double v, sc_time_unit tu )
+    { return sc_coro_trigger( sc_time( v, tu ) ); }
+inline sc_coro_trigger co_wait( const sc_time& t, const sc_event& e )
+    { return sc_coro_trigger( t )( e ); }
+inline sc_coro_trigger co_wait( double v, sc_time_unit tu, const sc_event& e )
+    { return sc_coro_trigger( sc_time( v, tu ) )( e ); }
+inline sc_coro_trigger co_wait( const sc_time& t, const sc_event_or_list& el )
+    { return sc_coro_trigger( t )( el ); }
+inline sc_coro_trigger
+co_wait( double v, sc_time_unit tu, const sc_event_or_list& el )
+    { return sc_coro_trigger( sc_time( v, tu ) )( el ); }
+inline sc_coro_trigger co_wait( const sc_time& t, const sc_event_and_list& el )
+    { return sc_coro_trigger( t )( el ); }
+inline sc_coro_trigger
+co_wait( double v, sc_time_unit tu, const sc_event_and_list& el )
+    { return sc_coro_trigger( sc_time( v, tu ) )( el ); }
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_host
+//
+//  Semantics of a coroutine process, executed by its method process.
+// ----------------------------------------------------------------------------
+
+class sc_coro_host : public sc_process_host
+{
+public:
+
+    sc_coro_host() : m_coro() {}
+    virtual ~sc_coro_host() {}
+
+    // the method of the process, resumes the coroutine
+    void step()
+    {
+        if( !m_coro )
+            m_coro = start();
+
+        m_coro.resume();
+
+        if( m_coro.done() )
+        {
+            std::exception_ptr x = m_coro.exception();
+            m_coro = sc_coro(); // release the frame
+            if( x )
+                std::rethrow_exception( x );
+            sc_get_current_process_handle().kill();
+        }
+    }
+
+protected:
+
+    // call the coroutine function
+    virtual sc_coro start() = 0;
+
+private:
+    sc_coro m_coro; // the coroutine, once started.
+};
+
+template< typename Module >
+class sc_coro_object : public sc_coro_host
+{
+public:
+
+    typedef sc_coro (Module::*function_type)();
+
+    sc_coro_object( Module* module_p, function_type function_p )
+      : m_module_p( module_p ), m_function_p( function_p )
+    {}
+
+protected:
+
+    virtual sc_coro start()
+        { return ( m_module_p->*m_function_p )(); }
+
+private:
+    Module*       m_module_p;   // module of the process.
+    function_type m_function_p; // the coroutine function.
+};
+
+//------------------------------------------------------------------------------
+//"sc_create_coro_process"
+//
+// This function creates a coroutine process, which executes the given member
+// function of a module.  The process is a method process and supports the
+// same options (e.g., static sensitivity and dont_initialize()).
+//------------------------------------------------------------------------------
+template< typename Module >
+inline sc_process_handle
+sc_create_coro_process( const char* name_p, Module* module_p,
+                        sc_coro (Module::*function_p)() )
+{
+    sc_coro_host* host_p = new sc_coro_object<Module>( module_p, function_p );
+    return sc_get_curr_simcontext()->create_method_process(
+        name_p, true, SC_MAKE_FUNC_PTR( sc_coro_host, step ), host_p, 0 );
+}
+
+} // namespace sc_core
+
+#define declare_coro_process(handle, name, host_tag, func)                   \
+    {                                                                         \
+        ::sc_core::sc_process_handle handle =                                 \
+            ::sc_core::sc_create_coro_process( name, this, &host_tag::func ); \
+        this->sensitive << handle;                                            \
+        this->sensitive_pos << handle;                                        \
+        this->sensitive_neg << handle;                                        \
+    }
+
+#define SC_CORO(func)                                                         \
+    declare_coro_process( func ## _handle,                                    \
+                          #func,                                              \
+                          SC_CURRENT_USER_MODULE,                             \
+                          func )
+
+#endif // SC_HAS_COROUTINES_
+
+#endif // SC_CORO_H_INCLUDED_
+
+// Taf!
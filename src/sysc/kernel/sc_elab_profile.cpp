@@ -0,0 +1,289 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profile.cpp -- Collection and reporting of the elaboration profile
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_elab_profiler.h"
+#include "sysc/kernel/sc_process_profiler.h"
+
+#if defined(__GNUC__)
+# include <cxxabi.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+namespace sc_core {
+
+namespace {
+
+const char* const sc_elab_phase_names[sc_elab_profiler::phases] =
+{
+    "construction",
+    "before_end_of_elaboration",
+    "binding",
+    "end_of_elaboration",
+    "start_of_simulation"
+};
+
+struct sc_elab_entry
+{
+    std::string          name;
+    sc_dt::uint64        instances;
+    const sc_dt::uint64* ns;
+    sc_dt::uint64        total;
+};
+
+// descending host time, then ascending name
+bool sc_elab_entry_less( const sc_elab_entry& left,
+                         const sc_elab_entry& right )
+{
+    if( left.total != right.total )
+        return left.total > right.total;
+    return left.name < right.name;
+}
+
+std::string sc_elab_type_name( const std::type_info& type )
+{
+#if defined(__GNUC__)
+    int status = 0;
+    char* name = abi::__cxa_demangle( type.name(), 0, 0, &status );
+    if( name != 0 )
+    {
+        std::string result( name );
+        std::free( name );
+        return result;
+    }
+#endif
+    return type.name();
+}
+
+// JSON string (RFC 8259): quotes, backslashes and control characters escaped
+void sc_elab_json_string( ::std::ostream& os, const std::string& s )
+{
+    os << '"';
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        unsigned char c = static_cast<unsigned char>( s[i] );
+        if( c < 0x20 ) { // control characters as \u00XX
+            static const char hex[] = "0123456789abcdef";
+            os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+            continue;
+        }
+        if( s[i] == '"' || s[i] == '\\' )
+            os << '\\';
+        os << s[i];
+    }
+    os << '"';
+}
+
+// CSV field (RFC 4180): always quoted, embedded quotes are doubled
+void sc_elab_csv_string( ::std::ostream& os, const std::string& s )
+{
+    os << '"';
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        if( s[i] == '"' )
+            os << '"';
+        os << s[i];
+    }
+    os << '"';
+}
+
+double sc_elab_seconds( sc_dt::uint64 ns )
+{
+    return static_cast<double>( ns ) * 1e-9;
+}
+
+} // namespace
+
+sc_elab_profiler::sc_elab_profiler( sc_process_profile_format dump )
+  : m_dump( dump ), m_phase( construction )
+  , m_since( sc_process_profiler::host_now() ), m_frames(), m_records()
+{
+    std::fill( m_ns, m_ns + phases, sc_dt::uint64( 0 ) );
+}
+
+void
+sc_elab_profiler::enter( phase p )
+{
+    sc_dt::uint64 now = sc_process_profiler::host_now();
+    if( m_phase != phases )
+        m_ns[m_phase] += now - m_since;
+    m_since = now;
+    m_phase = p;
+}
+
+void
+sc_elab_profiler::push( const sc_object* owner )
+{
+    frame f = { owner, sc_process_profiler::host_now(), 0 };
+    m_frames.push_back( f );
+}
+
+//------------------------------------------------------------------------------
+//"sc_elab_profiler::pop"
+//
+// This method closes the innermost frame of the given owner, together with
+// any frames opened after it, e.g., by a constructor left via an exception.
+// The host time of the frame without its nested frames is charged to the
+// dynamic type of the owner.  Each callback in before_end_of_elaboration
+// counts as an instance of the type, since every object receives exactly
+// one of them.
+//------------------------------------------------------------------------------
+void
+sc_elab_profiler::pop( const sc_object& owner )
+{
+    std::size_t i = m_frames.size();
+    while( i != 0 && m_frames[i - 1].owner != &owner )
+        --i;
+    if( i == 0 )
+        return;
+
+    sc_dt::uint64 elapsed = sc_process_profiler::host_now()
+                          - m_frames[i - 1].start;
+    sc_dt::uint64 nested  = m_frames[i - 1].nested;
+    m_frames.resize( i - 1 );
+    if( !m_frames.empty() )
+        m_frames.back().nested += elapsed;
+
+    if( m_phase == phases )
+        return;
+
+    record_map::iterator it = m_records.find( &typeid( owner ) );
+    if( it == m_records.end() )
+    {
+        record r = { 0, { 0 } };
+        it = m_records.insert( record_map::value_type( &typeid( owner ), r ) )
+               .first;
+    }
+    it->second.ns[m_phase] += elapsed - nested;
+    if( m_phase == before_end_of_elaboration )
+        ++it->second.instances;
+}
+
+void
+sc_elab_profiler::write( ::std::ostream& os,
+                         sc_process_profile_format format ) const
+{
+    // the first entry holds the host time of the phases as a whole
+
+    sc_dt::uint64 phase_ns[phases];
+    std::copy( m_ns, m_ns + phases, phase_ns );
+    if( m_phase != phases )
+        phase_ns[m_phase] += sc_process_profiler::host_now() - m_since;
+
+    std::vector<sc_elab_entry> entries;
+    entries.reserve( m_records.size() + 1 );
+
+    sc_elab_entry all = { "(elaboration)", 0, phase_ns, 0 };
+    for( int p = 0; p < phases; ++p )
+        all.total += phase_ns[p];
+    for( record_map::const_iterator it = m_records.begin();
+         it != m_records.end(); ++it )
+    {
+        sc_elab_entry e =
+          { sc_elab_type_name( *it->first ), it->second.instances,
+            it->second.ns, 0 };
+        for( int p = 0; p < phases; ++p )
+            e.total += e.ns[p];
+        all.instances += e.instances;
+        entries.push_back( e );
+    }
+    std::stable_sort( entries.begin(), entries.end(), sc_elab_entry_less );
+    entries.insert( entries.begin(), all );
+
+    ::std::ios_base::fmtflags flags = os.flags();
+    ::std::streamsize precision = os.precision();
+    os << ::std::fixed << ::std::setprecision( 6 );
+
+    switch( format )
+    {
+      case SC_PROFILE_TEXT:
+        os << "Elaboration profile (" << m_records.size() << " types)\n"
+           << "host time [s] per phase:"
+           << " construction, before_end_of_elaboration, binding,\n"
+           << "  end_of_elaboration, start_of_simulation, total\n"
+           << ::std::setw(12) << "construct"
+           << ::std::setw(12) << "before_end"
+           << ::std::setw(12) << "binding"
+           << ::std::setw(12) << "end_elab"
+           << ::std::setw(12) << "start_sim"
+           << ::std::setw(12) << "total"
+           << ::std::setw(12) << "instances"
+           << "  type\n";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            for( int p = 0; p < phases; ++p )
+                os << ::std::setw(12) << sc_elab_seconds( entries[i].ns[p] );
+            os << ::std::setw(12) << sc_elab_seconds( entries[i].total )
+               << ::std::setw(12) << entries[i].instances
+               << "  " << entries[i].name << '\n';
+        }
+        break;
+
+      case SC_PROFILE_CSV:
+        os << "type,instances";
+        for( int p = 0; p < phases; ++p )
+            os << ',' << sc_elab_phase_names[p];
+        os << ",total\n";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            sc_elab_csv_string( os, entries[i].name );
+            os << ',' << entries[i].instances;
+            for( int p = 0; p < phases; ++p )
+                os << ',' << sc_elab_seconds( entries[i].ns[p] );
+            os << ',' << sc_elab_seconds( entries[i].total ) << '\n';
+        }
+        break;
+
+      case SC_PROFILE_JSON:
+        os << "[";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            os << ( i ? ",\n " : "\n " ) << "{ \"type\": ";
+            sc_elab_json_string( os, entries[i].name );
+            os << ", \"instances\": " << entries[i].instances;
+            for( int p = 0; p < phases; ++p )
+                os << ", \"" << sc_elab_phase_names[p] << "\": "
+                   << sc_elab_seconds( entries[i].ns[p] );
+            os << ", \"total\": " << sc_elab_seconds( entries[i].total )
+               << " }";
+        }
+        os << "\n]\n";
+        break;
+
+      default:
+        break;
+    }
+
+    os.flags( flags );
+    os.precision( precision );
+}
+
+} // namespace sc_core
+
+// Taf!
@@ -0,0 +1,59 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profile.h -- Host time of the elaboration phases
+
+  While enabled via sc_set_elaboration_profiling() or the environment
+  variable SC_ELAB_PROFILE, the kernel measures the host time of each
+  elaboration phase: the construction of the modules, the
+  before_end_of_elaboration callbacks, the binding of the ports, the
+  end_of_elaboration callbacks and the start_of_simulation callbacks.
+  Within each phase, the time is broken down by the dynamic type of the
+  modules, ports, exports and primitive channels.  The construction time
+  of a module excludes the time of its submodules.
+
+ *****************************************************************************/
+
+#ifndef SC_ELAB_PROFILE_H_INCLUDED_
+#define SC_ELAB_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_process_profile.h"
+
+namespace sc_core {
+
+// elaboration profiling, only allowed before the end of elaboration:
+//     enable = true to measure the elaboration phases,
+//     dump   = format of the report written to std::cout, once the
+//              start_of_simulation callbacks are done.
+extern SC_API void sc_set_elaboration_profiling( bool enable,
+    sc_process_profile_format dump = SC_PROFILE_NONE );
+extern SC_API bool sc_get_elaboration_profiling();
+
+// write the host time per elaboration phase and per type measured so far,
+// sorted by descending total host time of the types
+extern SC_API void sc_write_elaboration_profile( ::std::ostream& os,
+    sc_process_profile_format format = SC_PROFILE_TEXT );
+
+} // namespace sc_core
+
+#endif // SC_ELAB_PROFILE_H_INCLUDED_
+
+// Taf!
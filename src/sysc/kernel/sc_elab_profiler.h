@@ -0,0 +1,150 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profiler.h -- Collection of the elaboration profile
+
+  The simulation context owns a profiler while elaboration profiling is
+  enabled and tells it about the start of each elaboration phase.  The
+  constructors of the modules and the registries of the kernel open a
+  frame around the construction of a module and around each callback of
+  a module, port, export or primitive channel.  The host time of a frame
+  without the time of its nested frames is charged to the dynamic type of
+  the object and the current phase.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_ELAB_PROFILER_H_INCLUDED_
+#define SC_ELAB_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_elab_profile.h"
+#include "sysc/kernel/sc_object.h"
+
+#include <map>
+#include <typeinfo>
+#include <vector>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_elab_profiler
+//
+//  Accumulates the host time of the elaboration phases per type.
+// ----------------------------------------------------------------------------
+
+class sc_elab_profiler
+{
+public:
+
+    enum phase
+    {
+        construction,
+        before_end_of_elaboration,
+        binding,
+        end_of_elaboration,
+        start_of_simulation,
+        phases                     // number of phases, or no phase at all.
+    };
+
+    // charges the host time of a callback of an object
+    class scope
+    {
+    public:
+        scope( sc_elab_profiler* profiler_p, const sc_object& obj )
+          : m_profiler_p( profiler_p ), m_obj( obj )
+          { if( m_profiler_p ) m_profiler_p->push( &m_obj ); }
+        ~scope()
+          { if( m_profiler_p ) m_profiler_p->pop( m_obj ); }
+    private:
+        sc_elab_profiler* m_profiler_p;
+        const sc_object&  m_obj;
+    private:
+        // disabled
+        scope( const scope& );
+        scope& operator = ( const scope& );
+    };
+
+public:
+
+    explicit sc_elab_profiler( sc_process_profile_format dump );
+
+    sc_process_profile_format dump_format() const
+      { return m_dump; }
+
+    // the elaboration continues with the given phase (phases: it is over)
+    void enter( phase p );
+
+    // frame around the construction of a module
+    void begin_module( const sc_object& module_ )
+      { push( &module_ ); }
+    void end_module( const sc_object& module_ )
+      { pop( module_ ); }
+
+    // write the phases and the types measured so far
+    void write( ::std::ostream& os, sc_process_profile_format format ) const;
+
+private:
+
+    struct frame
+    {
+        const sc_object* owner;
+        sc_dt::uint64    start;    // host time of the push.
+        sc_dt::uint64    nested;   // host time of the nested frames.
+    };
+
+    struct record
+    {
+        sc_dt::uint64 instances;
+        sc_dt::uint64 ns[phases];
+    };
+
+    struct type_less
+    {
+        bool operator () ( const std::type_info* left,
+                           const std::type_info* right ) const
+          { return left->before( *right ); }
+    };
+
+    typedef std::map<const std::type_info*, record, type_less> record_map;
+
+    void push( const sc_object* owner );
+    void pop( const sc_object& owner );
+
+private:
+    sc_process_profile_format m_dump;        // report format.
+    phase                     m_phase;       // current phase.
+    sc_dt::uint64             m_since;       // host time of the phase start.
+    sc_dt::uint64             m_ns[phases];  // host time of each phase.
+    std::vector<frame>        m_frames;      // open frames, innermost last.
+    record_map                m_records;     // host time per type.
+
+private:
+    // disabled
+    sc_elab_profiler( const sc_elab_profiler& );
+    sc_elab_profiler& operator = ( const sc_elab_profiler& );
+};
+
+} // namespace sc_core
+
+#endif // SC_ELAB_PROFILER_H_INCLUDED_
+
+// Taf!
@@ -26,10 +26,14 @@
  CHANGE LOG APPEARS AT THE END OF THE FILE
  *****************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <string>
 
 #include "sysc/kernel/sc_event.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/kernel/sc_kernel_ids.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
 #include "sysc/kernel/sc_process.h"
@@ -58,13 +62,27 @@ const sc_event sc_event::none( kernel_event, "none" );
 const char*
 sc_event::basename() const
 {
-    const char* p = strrchr( m_name.c_str(), SC_HIERARCHY_CHAR );
-    return p ? (p + 1) : m_name.c_str();
+    const char* p = strrchr( m_name, SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : m_name;
+}
+
+// parallel-safe method processes shall neither notify nor cancel events
+static void
+sc_reject_parallel_notification( const sc_event& e, const char* what )
+{
+    std::stringstream msg;
+    msg << what << " of `" << e.name() << "' ignored";
+    SC_REPORT_ERROR( SC_ID_PARALLEL_SAFE_VIOLATION_, msg.str().c_str() );
 }
 
 void
 sc_event::cancel()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) && m_notify_type != NONE ) {
+        sc_reject_parallel_notification( *this, "cancellation" );
+        return;
+    }
+
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
@@ -76,8 +94,7 @@ sc_event::cancel()
     case TIMED: {
         // remove this event from the timed events set
         sc_assert( m_timed != 0 );
-        m_timed->m_event = 0;
-        m_timed = 0;
+        m_simc->remove_timed_event( m_timed );
         m_notify_type = NONE;
         break;
     }
@@ -90,6 +107,10 @@ sc_event::cancel()
 void
 sc_event::notify()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_reject_parallel_notification( *this, "immediate notification" );
+        return;
+    }
     // immediate notification
     if( !m_simc->evaluation_phase() )
         // coming from
@@ -107,6 +128,10 @@ sc_event::notify()
 void
 sc_event::notify( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_reject_parallel_notification( *this, "notification" );
+        return;
+    }
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -127,8 +152,7 @@ sc_event::notify( const sc_time& t )
         if( m_notify_type == TIMED ) {
             // remove this event from the timed events set
             sc_assert( m_timed != 0 );
-            m_timed->m_event = 0;
-            m_timed = 0;
+            m_simc->remove_timed_event( m_timed );
         }
         // add this event to the delta events set
         m_delta_event_index = m_simc->add_delta_event( this );
@@ -154,8 +178,7 @@ sc_event::notify( const sc_time& t )
             return;
         }
         // remove this event from the timed events set
-        m_timed->m_event = 0;
-        m_timed = 0;
+        m_simc->remove_timed_event( m_timed );
     }
     // add this event to the timed events set
     sc_event_timed* et = new sc_event_timed( this, m_simc->time_stamp() + t );
@@ -178,6 +201,10 @@ static void sc_warn_notify_delayed()
 void
 sc_event::notify_delayed()
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_reject_parallel_notification( *this, "notification" );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -190,6 +217,10 @@ sc_event::notify_delayed()
 void
 sc_event::notify_delayed( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->parallel_phase() ) ) {
+        sc_reject_parallel_notification( *this, "notification" );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -208,9 +239,10 @@ sc_event::notify_delayed( const sc_time& t )
     }
 }
 
-#define SC_KERNEL_EVENT_PREFIX "$$$$kernel_event$$$$_"
 sc_event::kernel_tag sc_event::kernel_event;
 
+#define SC_KERNEL_EVENT_PREFIX "$$$$kernel_event$$$$_"
+
 // +----------------------------------------------------------------------------
 // |"sc_event::register_event"
 // |
@@ -221,6 +253,10 @@ sc_event::kernel_tag sc_event::kernel_event;
 // |   (a) the leaf name is non-null and is_kernel_event == false
 // |   (b) the event is being created before the start of simulation.
 // |
+// | Kernel events are named like other events, after the leaf name prepended
+// | with SC_KERNEL_EVENT_PREFIX, but their names are only interned by the
+// | object manager of the simulation context.
+// |
 // | Arguments:
 // |     leaf_name = leaf name of the object or NULL.
 // +----------------------------------------------------------------------------
@@ -229,6 +265,7 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
 {
     sc_object_manager* object_manager = m_simc->get_object_manager();
     m_parent_p = m_simc->active_object();
+    std::string kernel_name; // leaf name with prefix.
 
     // No name provided, if we are not executing then create a name:
 
@@ -242,24 +279,28 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
     // prepend kernel events with internal prefix
     else if ( is_kernel_event )
     {
-        m_name = SC_KERNEL_EVENT_PREFIX;
-        m_name.append( leaf_name );
-        leaf_name = m_name.c_str();
+        kernel_name = SC_KERNEL_EVENT_PREFIX;
+        kernel_name.append( leaf_name );
+        leaf_name = kernel_name.c_str();
     }
 
     // Create a hierarchichal name and place it into the object manager if
     // its not a kernel event:
 
-    object_manager->create_name( leaf_name ).swap( m_name );
-
-    if ( !is_kernel_event )
+    std::string name = object_manager->create_name( leaf_name );
+    if ( is_kernel_event )
     {
-	object_manager->insert_event(m_name, this);
-	if ( m_parent_p )
-	    m_parent_p->add_child_event( this );
-	else
-	    m_simc->add_child_event( this );
+        m_name = object_manager->intern_name( name );
+        return;
     }
+
+    m_name = object_manager->insert_event( name, this );
+    m_registered = true;
+
+    if ( m_parent_p )
+        m_parent_p->add_child_event( this );
+    else
+        m_simc->add_child_event( this );
 }
 
 void
@@ -285,13 +326,16 @@ sc_event::reset()
 // |     name = name of the event.
 // +----------------------------------------------------------------------------
 sc_event::sc_event( const char* name ) :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
+    m_static_frozen( true ),
+    m_lazy_edge( false ),
+    m_registered( false ),
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
@@ -308,13 +352,16 @@ sc_event::sc_event( const char* name ) :
 // | hierarchy.
 // +----------------------------------------------------------------------------
 sc_event::sc_event() :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
+    m_static_frozen( true ),
+    m_lazy_edge( false ),
+    m_registered( false ),
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
@@ -327,17 +374,20 @@ sc_event::sc_event() :
 // |"sc_event::sc_event(kernel_event, name)"
 // |
 // | This is the object instance constructor for kernel sc_event instances.
-// | If this is during elaboration create an implementation-defined name and
-// | do NOT add it to the object hierarchy.
+// | The event keeps the supplied name as its implementation-defined name and
+// | is NOT added to the object hierarchy.
 // +----------------------------------------------------------------------------
 sc_event::sc_event( kernel_tag, const char* name ) :
-    m_name(),
+    m_name(""),
     m_parent_p(NULL),
     m_simc( sc_get_curr_simcontext() ),
     m_trigger_stamp( ~sc_dt::UINT64_ZERO ),
     m_notify_type( NONE ),
     m_delta_event_index( -1 ),
     m_timed( 0 ),
+    m_static_frozen( true ),
+    m_lazy_edge( false ),
+    m_registered( false ),
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
@@ -356,7 +406,7 @@ sc_event::sc_event( kernel_tag, const char* name ) :
 sc_event::~sc_event()
 {
     cancel();
-    if ( m_name.length() != 0 )
+    if ( m_registered )
     {
 	sc_object_manager* object_manager_p = m_simc->get_object_manager();
 	object_manager_p->remove_event( m_name );
@@ -390,6 +440,13 @@ sc_event::trigger()
     int       last_i; // index of last element in vector now accessing.
     int       size;   // size of vector now accessing.
 
+    if( SC_UNLIKELY_( !m_static_frozen ) ) {
+        freeze_static();
+    }
+
+    // the process triggering this event (to detect self-notifications)
+
+    sc_process_b* curr_p = m_simc->get_curr_proc_info()->process_handle;
 
     // trigger the static sensitive methods
 
@@ -399,7 +456,7 @@ sc_event::trigger()
         int i = size - 1;
         do {
             sc_method_handle method_h = l_methods_static[i];
-            method_h->trigger_static();
+            method_h->trigger_static( curr_p );
         } while( -- i >= 0 );
     }
 
@@ -432,7 +489,7 @@ sc_event::trigger()
         int i = size - 1;
         do {
             sc_thread_handle thread_h = l_threads_static[i];
-            thread_h->trigger_static();
+            thread_h->trigger_static( curr_p );
         } while( -- i >= 0 );
     }
 
@@ -456,6 +513,78 @@ sc_event::trigger()
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_remove_duplicates"
+// |
+// | This function removes duplicate entries from a static sensitivity list,
+// | preserving the order of the remaining entries.
+// +----------------------------------------------------------------------------
+template< typename Handle >
+static void
+sc_remove_duplicates( std::vector<Handle>& handles )
+{
+    if( handles.size() < 2 ) {
+        return;
+    }
+
+    std::vector<Handle> sorted( handles );
+    std::sort( sorted.begin(), sorted.end(), std::less<Handle>() );
+    if( std::adjacent_find( sorted.begin(), sorted.end() ) == sorted.end() ) {
+        return; // common case: nothing to do
+    }
+    sorted.erase( std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+
+    std::vector<bool> seen( sorted.size(), false );
+    std::size_t       size = 0;
+    for( std::size_t i = 0; i < handles.size(); ++i )
+    {
+        std::size_t j = std::lower_bound( sorted.begin(), sorted.end(),
+                                          handles[i], std::less<Handle>() )
+                        - sorted.begin();
+        if( !seen[j] ) {
+            seen[j] = true;
+            handles[size++] = handles[i];
+        }
+    }
+    handles.resize( size );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_event::freeze_static"
+// |
+// | This method prepares the static sensitivity lists for triggering after
+// | they have been modified: Duplicate entries (e.g., ports bound to the same
+// | channel) are removed, such that each process is triggered at most once.
+// | The lists are then trimmed to their contiguous minimal size.
+// +----------------------------------------------------------------------------
+void
+sc_event::freeze_static() const
+{
+    sc_remove_duplicates( m_methods_static );
+    sc_remove_duplicates( m_threads_static );
+    if( m_methods_static.capacity() > m_methods_static.size() ) {
+        std::vector<sc_method_handle>( m_methods_static ).swap( m_methods_static );
+    }
+    if( m_threads_static.capacity() > m_threads_static.size() ) {
+        std::vector<sc_thread_handle>( m_threads_static ).swap( m_threads_static );
+    }
+    m_static_frozen = true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_event::wake_lazy_clock"
+// |
+// | This method resumes the edges of the suspended lazy clock owning this
+// | event, after a process has become sensitive to it.
+// +----------------------------------------------------------------------------
+void
+sc_event::wake_lazy_clock() const
+{
+    sc_clock* clock_p = dynamic_cast<sc_clock*>( m_parent_p );
+    if( clock_p )
+        clock_p->wake_up();
+}
+
 bool sc_event::triggered() const
 {
     return m_trigger_stamp == m_simc->change_stamp();
@@ -588,81 +717,146 @@ void
 sc_event_list::push_back( const sc_event& e )
 {
     // make sure e is not already in the list
-    if ( m_events.size() != 0 ) {
-      const sc_event** l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          if( &e == l_events[i] ) {
-              // event already in the list; ignore
-              return;
-          }
-      }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        if( &e == m_events[i] ) {
+            // event already in the list; ignore
+            return;
+        }
     }
-    m_events.push_back( &e );
+    if( m_size == m_capacity )
+        reserve( 2 * m_capacity );
+    m_events[m_size++] = &e;
 }
 
 void
 sc_event_list::push_back( const sc_event_list& el )
 {
-    m_events.reserve( size() + el.size() );
-    for ( int i = el.m_events.size() - 1; i >= 0; --i )
+    reserve( m_size + el.m_size );
+    for ( int i = el.m_size - 1; i >= 0; --i )
     {
         push_back( *el.m_events[i] );
     }
     el.auto_delete();
 }
 
+void
+sc_event_list::reserve( unsigned capacity )
+{
+    if( capacity <= m_capacity )
+        return;
+
+    const sc_event** events = new const sc_event*[capacity];
+    std::copy( m_events, m_events + m_size, events );
+    if( m_events != m_inline_events )
+        delete [] m_events;
+    m_events   = events;
+    m_capacity = capacity;
+}
+
+void
+sc_event_list::assign( const sc_event_list& that )
+{
+    m_size = 0;
+    reserve( that.m_size );
+    std::copy( that.m_events, that.m_events + that.m_size, m_events );
+    m_size = that.m_size;
+}
+
+//------------------------------------------------------------------------------
+//"sc_event_list::auto_delete"
+//
+// This method disposes of a temporary list (of an event expression), which
+// the given process no longer waits for.  Each process keeps one free OR and
+// one free AND list for the next expression it evaluates (see
+// new_temporary), so that waiting on expressions of a few events does not
+// allocate any memory.
+//------------------------------------------------------------------------------
+void
+sc_event_list::auto_delete( sc_process_b* proc_p ) const
+{
+    if( m_busy ) {
+        --m_busy;
+    }
+    if( m_busy || ! m_auto_delete ) {
+        return;
+    }
+
+    sc_event_list*& free_p = proc_p->m_free_event_lists[m_and_list];
+    if( free_p ) {
+        delete this;
+    } else {
+        free_p = const_cast<sc_event_list*>( this );
+        free_p->m_size = 0;
+    }
+}
+
+sc_event_list*
+sc_event_list::take_temporary( bool and_list_ )
+{
+    sc_process_b* proc_p = sc_get_current_process_b();
+    if( !proc_p )
+        return 0;
+    sc_event_list* list_p = proc_p->m_free_event_lists[and_list_];
+    proc_p->m_free_event_lists[and_list_] = 0;
+    return list_p;
+}
+
+sc_event_or_list*
+sc_event_or_list::new_temporary()
+{
+    sc_event_list* list_p = take_temporary( false );
+    return list_p ? static_cast<sc_event_or_list*>( list_p )
+                  : new sc_event_or_list( true );
+}
+
+sc_event_and_list*
+sc_event_and_list::new_temporary()
+{
+    sc_event_list* list_p = take_temporary( true );
+    return list_p ? static_cast<sc_event_and_list*>( list_p )
+                  : new sc_event_and_list( true );
+}
+
 void
 sc_event_list::add_dynamic( sc_method_handle method_h ) const
 {
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const * l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( method_h );
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        m_events[i]->add_dynamic( method_h );
+    }
 }
 
 void
 sc_event_list::add_dynamic( sc_thread_handle thread_h ) const
 {
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( thread_h );
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        m_events[i]->add_dynamic( thread_h );
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_method_handle method_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( method_h );
-          }
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = m_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( method_h );
+        }
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_thread_handle thread_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( thread_h );
-          }
-      }
-  }
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = m_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( thread_h );
+        }
+    }
 }
 
 void
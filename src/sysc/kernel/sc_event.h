@@ -35,6 +35,8 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/communication/sc_writer_policy.h"
 
+#include <algorithm> // std::swap
+
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
 #pragma warning(push)
 #pragma warning(disable: 4251) // DLL import for std::string
@@ -70,7 +72,7 @@ class sc_event_expr
     typedef T type;
 
     inline sc_event_expr()
-       : m_expr( new T(true) )
+       : m_expr( T::new_temporary() )
     {}
 
 public:
@@ -154,6 +156,8 @@ protected:
 
     void swap( sc_event_list& );
     void move_from( const sc_event_list& );
+    void assign( const sc_event_list& );
+    void reserve( unsigned );
 
     bool and_list() const;
 
@@ -165,16 +169,24 @@ protected:
     bool busy()        const;
     bool temporary()   const;
     void auto_delete() const;
+    void auto_delete( sc_process_b* ) const;
+    static sc_event_list* take_temporary( bool and_list_ );
 
     void report_premature_destruction() const;
     void report_invalid_modification()  const;
 
 private:
 
-    std::vector<const sc_event*> m_events;
+    // lists of up to inline_size events do not allocate any memory
+    enum { inline_size = 4 };
+
+    const sc_event**             m_events;       // inline or heap array.
+    unsigned                     m_size;         // number of events.
+    unsigned                     m_capacity;     // size of m_events.
     bool                         m_and_list;
     bool                         m_auto_delete;
     mutable unsigned             m_busy;
+    const sc_event*              m_inline_events[inline_size];
 };
 
 
@@ -198,6 +210,9 @@ protected:
     explicit
     sc_event_and_list( bool auto_delete_ );
 
+    // temporary list of an expression, reused from the current process
+    static sc_event_and_list* new_temporary();
+
 public:
 
     sc_event_and_list();
@@ -233,6 +248,9 @@ protected:
     explicit
     sc_event_or_list( bool auto_delete_ );
 
+    // temporary list of an expression, reused from the current process
+    static sc_event_or_list* new_temporary();
+
 public:
     sc_event_or_list();
     sc_event_or_list( const sc_event& );
@@ -263,7 +281,10 @@ class SC_API sc_event
     friend class sc_thread_process;
     friend void sc_thread_cor_fn( void* arg );
     friend class sc_clock;
+    friend class sc_clock_domain;
     friend class sc_event_queue;
+    friend class sc_offload_pool;
+    friend class sc_prim_channel_registry;
     friend class sc_signal_channel;
     template<typename IF> friend class sc_fifo;
     friend class sc_semaphore;
@@ -279,10 +300,10 @@ public:
 
     void cancel();
 
-    const char* name() const             { return m_name.c_str(); }
+    const char* name() const             { return m_name; }
     const char* basename() const;
     sc_object* get_parent_object() const { return m_parent_p; }
-    bool in_hierarchy() const            { return m_name.length() != 0; }
+    bool in_hierarchy() const            { return m_name[0] != 0; }
 
     void notify();
     void notify( const sc_time& );
@@ -315,9 +336,12 @@ private:
 
     bool remove_static( sc_method_handle ) const;
     bool remove_static( sc_thread_handle ) const;
+    void freeze_static() const;
     bool remove_dynamic( sc_method_handle ) const;
     bool remove_dynamic( sc_thread_handle ) const;
 
+    void wake_lazy_clock() const;
+
     void register_event( const char* name, bool is_kernel_event = false );
     void reset();
 
@@ -327,13 +351,16 @@ private:
 
     enum notify_t { NONE, DELTA, TIMED };
 
-    std::string     m_name;     // name of object.
+    const char*     m_name;     // name interned by the object manager.
     sc_object*      m_parent_p; // parent sc_object for this event.
     sc_simcontext*  m_simc;
     sc_dt::uint64   m_trigger_stamp; // delta of last trigger
     notify_t        m_notify_type;
     int             m_delta_event_index;
     sc_event_timed* m_timed;
+    mutable bool    m_static_frozen; // static lists free of duplicates?
+    mutable bool    m_lazy_edge;     // event of a suspended lazy clock?
+    bool            m_registered;    // name inserted into object manager?
 
     mutable std::vector<sc_method_handle> m_methods_static;
     mutable std::vector<sc_method_handle> m_methods_dynamic;
@@ -341,6 +368,7 @@ private:
     mutable std::vector<sc_thread_handle> m_threads_dynamic;
 
 private:
+    // kernel events are named after the supplied leaf name, with a prefix.
     static struct kernel_tag {} kernel_event;
     explicit sc_event( kernel_tag, const char* name = NULL );
 
@@ -359,13 +387,14 @@ class SC_API sc_event_timed
 {
     friend class sc_event;
     friend class sc_simcontext;
+    friend class sc_timed_queue;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
 
 private:
 
     sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+        : m_event( e ), m_notify_time( t ), m_queue_index( -1 )
         {}
 
     ~sc_event_timed()
@@ -393,6 +422,7 @@ private:
 
     sc_event* m_event;
     sc_time   m_notify_time;
+    int       m_queue_index; // position within the timed event queue
 
 private:
 
@@ -455,6 +485,9 @@ void
 sc_event::add_static( sc_method_handle method_h ) const
 {
     m_methods_static.push_back( method_h );
+    m_static_frozen = false;
+    if( SC_UNLIKELY_( m_lazy_edge ) )
+        wake_lazy_clock();
 }
 
 inline
@@ -462,6 +495,9 @@ void
 sc_event::add_static( sc_thread_handle thread_h ) const
 {
     m_threads_static.push_back( thread_h );
+    m_static_frozen = false;
+    if( SC_UNLIKELY_( m_lazy_edge ) )
+        wake_lazy_clock();
 }
 
 inline
@@ -469,6 +505,8 @@ void
 sc_event::add_dynamic( sc_method_handle method_h ) const
 {
     m_methods_dynamic.push_back( method_h );
+    if( SC_UNLIKELY_( m_lazy_edge ) )
+        wake_lazy_clock();
 }
 
 inline
@@ -476,6 +514,8 @@ void
 sc_event::add_dynamic( sc_thread_handle thread_h ) const
 {
     m_threads_dynamic.push_back( thread_h );
+    if( SC_UNLIKELY_( m_lazy_edge ) )
+        wake_lazy_clock();
 }
 
 
@@ -492,7 +532,9 @@ extern void notify( double v, sc_time_unit tu, sc_event& e );
 
 inline
 sc_event_list::sc_event_list( bool and_list_, bool auto_delete_ ) 
-  : m_events() 
+  : m_events( m_inline_events )
+  , m_size( 0 )
+  , m_capacity( inline_size )
   , m_and_list( and_list_ ) 
   , m_auto_delete( auto_delete_ ) 
   , m_busy( 0 )
@@ -503,17 +545,21 @@ inline
 sc_event_list::sc_event_list( const sc_event& e,
                               bool and_list_,
                               bool auto_delete_ )
-  : m_events()
+  : m_events( m_inline_events )
+  , m_size( 1 )
+  , m_capacity( inline_size )
   , m_and_list( and_list_ )
   , m_auto_delete( auto_delete_ )
   , m_busy(0)
 {
-    m_events.push_back( &e );
+    m_events[0] = &e;
 }
 
 inline
 sc_event_list::sc_event_list( sc_event_list const & that )
-  : m_events()
+  : m_events( m_inline_events )
+  , m_size( 0 )
+  , m_capacity( inline_size )
   , m_and_list( that.m_and_list )
   , m_auto_delete( false )
   , m_busy( 0 )
@@ -542,6 +588,8 @@ sc_event_list::~sc_event_list()
 {
     if( m_busy )
         report_premature_destruction();
+    if( m_events != m_inline_events )
+        delete [] m_events;
 }
 
 inline
@@ -550,7 +598,18 @@ sc_event_list::swap( sc_event_list& that )
 {
     if( busy() || that.busy() )
         report_invalid_modification();
-    m_events.swap( that.m_events );
+
+    // swap the inline arrays as well, and let lists using them point to
+    // their own one afterwards
+    for( int i = 0; i < inline_size; ++i )
+        std::swap( m_inline_events[i], that.m_inline_events[i] );
+    std::swap( m_events, that.m_events );
+    std::swap( m_size, that.m_size );
+    std::swap( m_capacity, that.m_capacity );
+    if( m_events == that.m_inline_events )
+        m_events = m_inline_events;
+    if( that.m_events == m_inline_events )
+        that.m_events = that.m_inline_events;
 }
 
 inline
@@ -560,7 +619,7 @@ sc_event_list::move_from( sc_event_list const&  that )
     if( that.temporary() ) {
         swap( const_cast<sc_event_list&>(that) ); // move from source
     } else {
-        m_events = that.m_events;                 // copy from source
+        assign( that );                           // copy from source
     }
 }
 
@@ -568,7 +627,7 @@ inline
 int
 sc_event_list::size() const
 {
-    return static_cast<int>(m_events.size());
+    return static_cast<int>(m_size);
 }
 
 inline
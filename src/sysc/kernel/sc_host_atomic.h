@@ -0,0 +1,136 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_host_atomic.h -- An atomic variable shared between host threads
+
+  Minimal wrapper for pointers, integers and booleans accessed concurrently
+  by several host threads (e.g., by external threads calling
+  async_request_update()).  All operations are sequentially consistent.
+
+  Uses std::atomic with C++11, the __atomic builtins of GCC and Clang for
+  older language versions and falls back to a host mutex otherwise.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_HOST_ATOMIC_H_INCLUDED_
+#define SC_HOST_ATOMIC_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 201103L
+# include <atomic>
+# define SC_HOST_ATOMIC_STD_ 1
+#elif defined(__ATOMIC_SEQ_CST)
+# define SC_HOST_ATOMIC_BUILTIN_ 1
+#else
+# include "sysc/communication/sc_host_mutex.h"
+# define SC_HOST_ATOMIC_MUTEX_ 1
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_host_atomic<T>
+//
+//   Atomic variable of a scalar type T
+// ----------------------------------------------------------------------------
+
+template< typename T >
+class sc_host_atomic
+{
+public:
+
+    explicit sc_host_atomic( T value = T() ) : m_value( value ) {}
+
+#if defined(SC_HOST_ATOMIC_STD_)
+
+    T load() const
+      { return m_value.load(); }
+    void store( T value )
+      { m_value.store( value ); }
+    T exchange( T value )
+      { return m_value.exchange( value ); }
+    bool compare_exchange( T& expected, T desired )
+      { return m_value.compare_exchange_strong( expected, desired ); }
+
+private:
+    std::atomic<T> m_value;
+
+#elif defined(SC_HOST_ATOMIC_BUILTIN_)
+
+    T load() const
+      { return __atomic_load_n( &m_value, __ATOMIC_SEQ_CST ); }
+    void store( T value )
+      { __atomic_store_n( &m_value, value, __ATOMIC_SEQ_CST ); }
+    T exchange( T value )
+      { return __atomic_exchange_n( &m_value, value, __ATOMIC_SEQ_CST ); }
+    bool compare_exchange( T& expected, T desired )
+    {
+        return __atomic_compare_exchange_n( &m_value, &expected, desired,
+                 false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST );
+    }
+
+private:
+    T m_value;
+
+#else // SC_HOST_ATOMIC_MUTEX_
+
+    T load() const
+      { sc_scoped_lock lock( m_mutex ); return m_value; }
+    void store( T value )
+      { sc_scoped_lock lock( m_mutex ); m_value = value; }
+    T exchange( T value )
+    {
+        sc_scoped_lock lock( m_mutex );
+        T old = m_value;
+        m_value = value;
+        return old;
+    }
+    bool compare_exchange( T& expected, T desired )
+    {
+        sc_scoped_lock lock( m_mutex );
+        if( m_value != expected ) {
+            expected = m_value;
+            return false;
+        }
+        m_value = desired;
+        return true;
+    }
+
+private:
+    mutable sc_host_mutex m_mutex;
+    T                     m_value;
+
+#endif // implementation
+
+private:
+    // disabled
+    sc_host_atomic( const sc_host_atomic& );
+    sc_host_atomic& operator = ( const sc_host_atomic& );
+};
+
+} // namespace sc_core
+
+#endif // SC_HOST_ATOMIC_H_INCLUDED_
+
+// Taf!
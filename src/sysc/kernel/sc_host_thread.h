@@ -0,0 +1,226 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_host_thread.h -- A "real" thread of the underlying host system
+
+  Used by kernel facilities which distribute work to host threads (e.g.,
+  the parallel evaluation of method processes).  Host threads are only
+  available, if the SystemC library is linked against the host threading
+  library, which is the case whenever async_request_update() or POSIX
+  thread coroutines are enabled.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_HOST_THREAD_H_INCLUDED_
+#define SC_HOST_THREAD_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+#if !defined(SC_DISABLE_ASYNC_UPDATES) || defined(SC_USE_PTHREADS) \
+    || defined(WIN32) || defined(_WIN32)
+# define SC_HAS_HOST_THREADS_ 1
+#else
+# define SC_HAS_HOST_THREADS_ 0
+#endif
+
+#if SC_HAS_HOST_THREADS_
+# if SC_CPLUSPLUS >= 201103L
+#   include <thread>
+# elif !defined(WIN32) && !defined(_WIN32) // use POSIX threads
+#   include <pthread.h>
+#   include <unistd.h>
+# else // use Windows threads
+#   ifndef SC_INCLUDE_WINDOWS_H
+#     define SC_INCLUDE_WINDOWS_H // include Windows.h, if needed
+#     include "sysc/kernel/sc_cmnhdr.h"
+#   endif
+# endif // SC_CPLUSPLUS
+#endif // SC_HAS_HOST_THREADS_
+
+// thread-local storage specifier for kernel-internal per-host-thread state
+#if SC_CPLUSPLUS >= 201103L
+# define SC_HOST_THREAD_LOCAL_ thread_local
+#elif defined(_MSC_VER)
+# define SC_HOST_THREAD_LOCAL_ __declspec(thread)
+#else
+# define SC_HOST_THREAD_LOCAL_ __thread
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_host_thread
+//
+//   The sc_host_thread class, wrapping an OS thread on the simulation host
+// ----------------------------------------------------------------------------
+
+class sc_host_thread
+{
+public:
+
+    typedef void (*entry_fn)( void* );
+
+private:
+
+    struct start_info
+    {
+        entry_fn fn;
+        void*    arg;
+    };
+
+#if !SC_HAS_HOST_THREADS_
+
+    typedef int underlying_type;
+
+    bool do_start()           { return false; }
+    void do_join()            { /* no-op */ }
+    static unsigned do_cpus() { return 1; }
+
+#elif SC_CPLUSPLUS >= 201103L
+
+    typedef std::thread* underlying_type;
+
+    bool do_start()
+    {
+        m_thread = new std::thread( m_start.fn, m_start.arg );
+        return true;
+    }
+    void do_join()
+    {
+        m_thread->join();
+        delete m_thread;
+        m_thread = 0;
+    }
+    static unsigned do_cpus()
+      { return std::thread::hardware_concurrency(); }
+
+#elif defined(WIN32) || defined(_WIN32) // use Windows threads
+
+    typedef HANDLE underlying_type;
+
+    static DWORD WINAPI trampoline( LPVOID p )
+    {
+        start_info* info_p = static_cast<start_info*>( p );
+        info_p->fn( info_p->arg );
+        return 0;
+    }
+    bool do_start()
+    {
+        m_thread = CreateThread( NULL, 0, &trampoline, &m_start, 0, NULL );
+        return m_thread != NULL;
+    }
+    void do_join()
+    {
+        WaitForSingleObject( m_thread, INFINITE );
+        CloseHandle( m_thread );
+        m_thread = NULL;
+    }
+    static unsigned do_cpus()
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo( &info );
+        return info.dwNumberOfProcessors;
+    }
+
+#else // use POSIX threads
+
+    typedef pthread_t underlying_type;
+
+    static void* trampoline( void* p )
+    {
+        start_info* info_p = static_cast<start_info*>( p );
+        info_p->fn( info_p->arg );
+        return NULL;
+    }
+    bool do_start()
+      { return pthread_create( &m_thread, NULL, &trampoline, &m_start ) == 0; }
+    void do_join()
+      { pthread_join( m_thread, NULL ); }
+    static unsigned do_cpus()
+    {
+#     if defined(_SC_NPROCESSORS_ONLN)
+        long n = sysconf( _SC_NPROCESSORS_ONLN );
+        return n > 0 ? static_cast<unsigned>( n ) : 1u;
+#     else
+        return 1;
+#     endif
+    }
+
+#endif // platform-specific implementation
+
+public:
+
+    // constructors and destructor
+
+    sc_host_thread() : m_thread(), m_running( false )
+      { m_start.fn = 0; m_start.arg = 0; }
+    ~sc_host_thread()
+      { join(); }
+
+    // start executing fn(arg) on a new host thread,
+    // returns false if no host threads are available
+    bool start( entry_fn fn, void* arg )
+    {
+        sc_assert( !m_running );
+        m_start.fn  = fn;
+        m_start.arg = arg;
+        m_running   = do_start();
+        return m_running;
+    }
+
+    // wait for the completion of a started thread
+    void join()
+    {
+        if( m_running ) {
+            do_join();
+            m_running = false;
+        }
+    }
+
+    bool running() const
+      { return m_running; }
+
+    // number of processors available on the host (at least 1)
+    static unsigned hardware_concurrency()
+    {
+        unsigned n = do_cpus();
+        return n ? n : 1u;
+    }
+
+private:
+    start_info      m_start;
+    underlying_type m_thread;
+    bool            m_running;
+
+private:
+    // disabled
+    sc_host_thread( const sc_host_thread& );
+    sc_host_thread& operator = ( const sc_host_thread& );
+};
+
+} // namespace sc_core
+
+#endif // SC_HOST_THREAD_H_INCLUDED_
+
+// Taf!
@@ -201,6 +201,41 @@ SC_DEFINE_MESSAGE(SC_ID_RESET_PROCESS_WHILE_NOT_RUNNING_  , 573,
         "a process may not be asynchronously reset while the simulation is not running" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_WHILE_NOT_RUNNING_  , 574,
         "throw_it not allowed unless simulation is running " )
+SC_DEFINE_MESSAGE(SC_ID_SET_PARALLEL_SAFE_           , 575,
+	"set_parallel_safe() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATION_AFTER_START_, 576,
+	"attempt to set parallel evaluation after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATION_UNAVAILABLE_, 577,
+	"parallel evaluation requires host thread support, "
+	"running sequentially" )
+SC_DEFINE_MESSAGE(SC_ID_TIMED_QUEUE_AFTER_START_     , 578,
+	"attempt to set timed queue policy after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PROCESS_PROFILING_AFTER_START_, 579,
+	"attempt to set process profiling after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_FORK_SIMULATION_UNAVAILABLE_ , 580,
+	"forking the simulation requires user-space coroutines "
+	"(QuickThreads)" )
+SC_DEFINE_MESSAGE(SC_ID_FORK_SIMULATION_NOT_PAUSED_  , 581,
+	"the simulation can only be forked before or between sc_start() calls" )
+SC_DEFINE_MESSAGE(SC_ID_OFFLOAD_FAILED_              , 582,
+	"offloaded computation failed" )
+SC_DEFINE_MESSAGE(SC_ID_OFFLOAD_THREADS_AFTER_START_ , 583,
+	"attempt to set offload threads after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILE_FILE_          , 584,
+	"stack profile file ignored" )
+SC_DEFINE_MESSAGE(SC_ID_ELAB_PROFILING_AFTER_START_  , 585,
+	"attempt to set elaboration profiling after elaboration will be "
+	"ignored" )
+SC_DEFINE_MESSAGE(SC_ID_DIRECT_PORT_ACCESS_AFTER_START_, 586,
+	"attempt to set direct port access after elaboration will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_SAFE_VIOLATION_     , 587,
+	"operation not allowed in a parallel-safe method process" )
+SC_DEFINE_MESSAGE(SC_ID_KERNEL_TASK_WITHOUT_CONTEXT_ , 588,
+	"kernel task posted without a simulation context, task discarded" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILING_AFTER_START_  , 589,
+	"attempt to set stack profiling after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_ARENA_AFTER_START_     , 590,
+	"attempt to set stack arena after start will be ignored" )
 
 
 /*****************************************************************************
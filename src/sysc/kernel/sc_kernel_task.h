@@ -0,0 +1,152 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_task.h -- Tasks posted to the simulation kernel by host threads
+
+  A kernel task is executed by the simulator thread during the update phase
+  of a delta cycle, i.e., in the same context as the update() method of a
+  primitive channel.  Hence, a task may write to primitive channels (e.g.,
+  sc_signal), call request_update() and notify events with a delta or
+  timed delay, but shall neither call an immediate notify() nor wait().
+
+  Tasks are posted via the asynchronous update machinery and can therefore
+  be posted from any host thread (and from the simulator itself).  Tasks
+  are executed in the order of their due time, tasks with the same due time
+  in the order they have been posted.
+
+  Host threads outside of the simulation shall pass the simulation context
+  explicitly, as obtained by sc_get_curr_simcontext() on the simulator
+  thread: such threads have no current context, in particular with
+  SC_ENABLE_THREAD_LOCAL_CONTEXTS, and tasks posted by them without a
+  context are discarded with an error.
+
+ *****************************************************************************/
+
+#ifndef SC_KERNEL_TASK_H_INCLUDED_
+#define SC_KERNEL_TASK_H_INCLUDED_
+
+#include "sysc/kernel/sc_time.h"
+
+namespace sc_core {
+
+class sc_prim_channel_registry;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_task
+//
+//  Abstract base class of tasks executed by the simulator thread.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_kernel_task
+{
+    friend class sc_prim_channel_registry;
+
+public:
+
+    explicit sc_kernel_task( const sc_time& delay = SC_ZERO_TIME )
+      : m_delay( delay ), m_next_p( 0 )
+    {}
+
+    virtual ~sc_kernel_task() {}
+
+    // the task itself, called once in the update phase
+    virtual void run() = 0;
+
+    // delay relative to the simulated time the task is accepted at
+    const sc_time& delay() const
+        { return m_delay; }
+
+private:
+    sc_time         m_delay;  // delay of the execution.
+    sc_kernel_task* m_next_p; // next task in the list of posted tasks.
+
+private:
+    // disabled
+    sc_kernel_task( const sc_kernel_task& );
+    sc_kernel_task& operator = ( const sc_kernel_task& );
+};
+
+//=============================================================================
+// CLASS sc_kernel_task_object<T>
+//
+// This templated helper class allows an object to provide the semantics of a
+// kernel task via its () operator.  A copy of the supplied object is kept
+// until the task has been executed.
+//=============================================================================
+template<typename T>
+class sc_kernel_task_object : public sc_kernel_task
+{
+  public:
+    sc_kernel_task_object( T object, const sc_time& delay )
+      : sc_kernel_task( delay ), m_object( object )
+    {}
+
+    virtual void run()
+    {
+        m_object();
+    }
+
+  protected:
+    T m_object;
+};
+
+//------------------------------------------------------------------------------
+//"sc_post_kernel_task"
+//
+// This function posts a task for execution by the simulator thread, which
+// takes ownership of the task and deletes it after its execution.
+//     task_p  -> task allocated with new.
+//     simc_p  -> simulation context to execute the task, or 0 for the
+//                current simulation context of the calling host thread,
+//                which is an error if the thread has none (see above).
+//------------------------------------------------------------------------------
+extern SC_API void
+sc_post_kernel_task( sc_kernel_task* task_p, sc_simcontext* simc_p = 0 );
+
+//------------------------------------------------------------------------------
+//"sc_post_to_kernel"
+//
+// This inline function posts the () operator of an object (e.g., an sc_bind
+// bound function) for execution by the simulator thread.  It may be called
+// from any host thread.
+//     object = object instance providing the task via its () operator.
+//     delay  = delay relative to the simulated time the simulator accepts
+//              the task at (SC_ZERO_TIME: next update phase).
+//     simc_p -> simulation context to execute the task, or 0 for the
+//               current simulation context of the calling host thread,
+//               which is an error if the thread has none (see above).
+//------------------------------------------------------------------------------
+template <typename T>
+inline void sc_post_to_kernel(
+    T object,
+    const sc_time& delay = SC_ZERO_TIME,
+    sc_simcontext* simc_p = 0 )
+{
+    sc_post_kernel_task( new sc_kernel_task_object<T>( object, delay ),
+                         simc_p );
+}
+
+} // namespace sc_core
+
+#endif // SC_KERNEL_TASK_H_INCLUDED_
+
+// Taf!
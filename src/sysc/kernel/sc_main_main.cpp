@@ -31,6 +31,7 @@
 #include "sysc/kernel/sc_cmnhdr.h"
 #include "sysc/kernel/sc_externs.h"
 #include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/utils/sc_report.h"
 #include "sysc/utils/sc_report_handler.h"
@@ -88,6 +89,9 @@ sc_elab_and_sim( int argc, char* argv[] )
         std::vector<char*> argv_call = argv_copy;
         status = sc_main( argc, &argv_call[0] );
 
+        // the simulation may end without sc_stop()
+        sc_get_curr_simcontext()->write_stack_profile();
+
         // Perform cleanup here
         sc_in_action = false;
     }
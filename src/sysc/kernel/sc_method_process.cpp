@@ -84,10 +84,15 @@ void sc_method_process::check_for_throws()
 //------------------------------------------------------------------------------
 //"sc_method_process::clear_trigger"
 //
-// This method clears any pending trigger for this object instance.
+// This method clears any pending trigger for this object instance. It is
+// called by each next_trigger() call, which is counted here while process
+// profiling is enabled.
 //------------------------------------------------------------------------------
 void sc_method_process::clear_trigger()
 {
+    if( SC_UNLIKELY_( simcontext()->m_process_profiler != 0 ) )
+        m_profile.count_wait();
+
     switch( m_trigger_type ) {
       case STATIC:
         return;
@@ -97,12 +102,12 @@ void sc_method_process::clear_trigger()
         break;
       case OR_LIST:
         m_event_list_p->remove_dynamic( this, 0 );
-        m_event_list_p->auto_delete();
+        m_event_list_p->auto_delete( this );
         m_event_list_p = 0;
         break;
       case AND_LIST:
         m_event_list_p->remove_dynamic( this, 0 );
-        m_event_list_p->auto_delete();
+        m_event_list_p->auto_delete( this );
         m_event_list_p = 0;
         m_event_count = 0;
         break;
@@ -120,14 +125,14 @@ void sc_method_process::clear_trigger()
         m_timeout_event_p->cancel();
         m_timeout_event_p->reset();
         m_event_list_p->remove_dynamic( this, 0 );
-        m_event_list_p->auto_delete();
+        m_event_list_p->auto_delete( this );
         m_event_list_p = 0;
       break;
       case AND_LIST_TIMEOUT:
         m_timeout_event_p->cancel();
         m_timeout_event_p->reset();
         m_event_list_p->remove_dynamic( this, 0 );
-        m_event_list_p->auto_delete();
+        m_event_list_p->auto_delete( this );
         m_event_list_p = 0;
         m_event_count = 0;
         break;
@@ -307,7 +312,7 @@ sc_method_process::sc_method_process( const char* name_p,
     sc_process_b(
         name_p ? name_p : sc_gen_unique_name("method_p"),
         false, free_host, method_p, host_p, opt_p),
-	m_cor(0), m_stack_size(0), m_monitor_q()
+	m_cor(0), m_stack_size(0), m_monitor_q(), m_parallel_safe(false)
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMUALTION HAS STARTED:
@@ -325,6 +330,7 @@ sc_method_process::sc_method_process( const char* name_p,
     m_process_kind = SC_METHOD_PROC_;
     if (opt_p) {
         m_dont_init = opt_p->m_dont_initialize;
+        m_parallel_safe = opt_p->m_parallel_safe;
 
         // traverse event sensitivity list
         for (unsigned int i = 0; i < opt_p->m_sensitive_events.size(); i++) {
@@ -701,7 +707,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
         -- m_event_count;
 	if ( m_event_count == 0 )
 	{
-	    m_event_list_p->auto_delete();
+	    m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
 	    m_trigger_type = STATIC;
 	}
@@ -713,7 +719,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
 
       case OR_LIST:
 	m_event_list_p->remove_dynamic( this, e );
-	m_event_list_p->auto_delete();
+	m_event_list_p->auto_delete( this );
 	m_event_list_p = 0;
 	m_trigger_type = STATIC;
 	break;
@@ -744,7 +750,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
 	{
             m_timed_out = true;
             m_event_list_p->remove_dynamic( this, e );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
             m_event_list_p = 0;
             m_trigger_type = STATIC;
 	}
@@ -754,7 +760,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
             m_timeout_event_p->cancel();
             m_timeout_event_p->reset();
 	    m_event_list_p->remove_dynamic( this, e );
-	    m_event_list_p->auto_delete();
+	    m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
 	    m_trigger_type = STATIC;
 	}
@@ -765,7 +771,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
 	{
             m_timed_out = true;
             m_event_list_p->remove_dynamic( this, e );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
             m_event_list_p = 0;
             m_trigger_type = STATIC;
 	}
@@ -778,7 +784,7 @@ bool sc_method_process::trigger_dynamic( sc_event* e )
 		m_timeout_event_p->cancel();
 		m_timeout_event_p->reset();
 		// no need to remove_dynamic
-		m_event_list_p->auto_delete();
+		m_event_list_p->auto_delete( this );
 		m_event_list_p = 0;
 		m_trigger_type = STATIC;
 	    }
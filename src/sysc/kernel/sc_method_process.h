@@ -107,6 +107,7 @@ class sc_method_process : public sc_process_b {
     friend void sc_set_stack_size( sc_method_handle, std::size_t );
     friend class sc_event;
     friend class sc_module;
+    friend class sc_parallel_evaluator;
     friend class sc_process_table;
     friend class sc_process_handle;
     friend class sc_simcontext;
@@ -143,6 +144,7 @@ class sc_method_process : public sc_process_b {
     virtual void enable_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     inline bool run_process();
+    inline bool run_parallel() const;
     virtual void kill_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     sc_method_handle next_exist();
@@ -166,12 +168,13 @@ class sc_method_process : public sc_process_b {
     virtual void throw_user( const sc_throw_it_helper& helper,
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline void trigger_static( sc_process_b* curr_p );
 
   protected:
     sc_cor*                          m_cor;        // Thread's coroutine.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
+    bool                             m_parallel_safe; // May run in parallel.
 
   private:
     // may not be deleted manually (called from sc_process_b)
@@ -320,6 +323,20 @@ inline bool sc_method_process::run_process()
     return true;
 }
 
+//------------------------------------------------------------------------------
+//"sc_method_process::run_parallel"
+//
+// This inline method returns true if this object instance may be executed
+// in parallel to other method processes of the current evaluation phase.
+// This requires the process to be marked as parallel-safe, and that no
+// reset or exception is pending for it.
+//------------------------------------------------------------------------------
+inline bool sc_method_process::run_parallel() const
+{
+    return m_parallel_safe && m_throw_status == THROW_NONE &&
+           !m_active_areset_n && !m_active_reset_n;
+}
+
 //------------------------------------------------------------------------------
 //"sc_method_process::trigger_static"
 //
@@ -332,20 +349,20 @@ inline bool sc_method_process::run_process()
 //       dynamic event waits take priority.
 //
 //
-// If the triggering process is the same process, the trigger is
+// If the triggering process (curr_p) is the same process, the trigger is
 // ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 // is defined.
 //------------------------------------------------------------------------------
 inline
 void
-sc_method_process::trigger_static()
+sc_method_process::trigger_static( sc_process_b* curr_p )
 {
     if ( (m_state & ps_bit_disabled) || is_runnable() ||
           m_trigger_type != STATIC )
         return;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
-    if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
+    if( SC_UNLIKELY_( curr_p == this ) )
     {
         report_immediate_self_notification();
         return;
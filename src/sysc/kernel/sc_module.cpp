@@ -33,6 +33,7 @@
 #include <cstdio>
 #include <sstream>
 
+#include "sysc/kernel/sc_elab_profiler.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
 #include "sysc/kernel/sc_module.h"
@@ -145,6 +146,8 @@ sc_module::sc_module_init()
 {
     simcontext()->get_module_registry()->insert( *this );
     simcontext()->hierarchy_push( this );
+    if( simcontext()->get_elab_profiler() )
+        simcontext()->get_elab_profiler()->begin_module( *this );
     m_end_module_called = false;
     m_module_name_p = 0;
     m_port_vec = new std::vector<sc_port_base*>;
@@ -270,20 +273,23 @@ sc_module::~sc_module()
 {
     delete m_port_vec;
     delete m_name_gen;
-    orphan_child_objects();
+    bool fast_teardown = simcontext()->in_fast_teardown();
+    if ( !fast_teardown )
+        orphan_child_objects();
     if ( m_module_name_p )
     {
 	m_module_name_p->clear_module( this ); // must be before end_module()
     	end_module();
     }
-    simcontext()->get_module_registry()->remove( *this );
+    if ( !fast_teardown )
+        simcontext()->get_module_registry()->remove( *this );
 }
 
 
 const ::std::vector<sc_object*>&
 sc_module::get_child_objects() const
 {
-    return m_child_objects;
+    return sc_object::get_child_objects();
 }
 
 // set SC_THREAD asynchronous reset sensitivity
@@ -325,6 +331,8 @@ sc_module::end_module()
 	sensitive_neg.reset();
 	m_end_module_called = true;
 	m_module_name_p = 0; // make sure we are not called in ~sc_module().
+	if( simcontext()->get_elab_profiler() )
+	    simcontext()->get_elab_profiler()->end_module( *this );
     }
 }
 
@@ -465,6 +473,25 @@ sc_module::set_stack_size( std::size_t size )
 }
 
 
+void
+sc_module::set_parallel_safe()
+{
+    sc_process_handle  proc_h( sc_get_last_created_process_handle() );
+    sc_method_handle   method_h;  // Last created process as method.
+
+
+    method_h = (sc_method_handle)proc_h;
+    if ( method_h )
+    {
+	method_h->m_parallel_safe = true;
+    }
+    else
+    {
+	SC_REPORT_WARNING( SC_ID_SET_PARALLEL_SAFE_, 0 );
+    }
+}
+
+
 int
 sc_module::append_port( sc_port_base* port_ )
 {
@@ -298,6 +298,9 @@ protected:
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
+    // Function to mark the last created method process as parallel-safe.
+    void set_parallel_safe();
+
     int append_port( sc_port_base* );
 
 private:
@@ -28,6 +28,7 @@
  *****************************************************************************/
 
 
+#include "sysc/kernel/sc_elab_profiler.h"
 #include "sysc/kernel/sc_kernel_ids.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_module_registry.h"
@@ -111,6 +112,8 @@ sc_module_registry::construction_done()
         return true;
 
     for( ; m_construction_done < size(); ++m_construction_done ) {
+        sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+                                       *m_module_vec[m_construction_done] );
         m_module_vec[m_construction_done]->construction_done();
     }
     return false;
@@ -123,6 +126,8 @@ sc_module_registry::elaboration_done()
 {
     bool error = false;
     for( int i = 0; i < size(); ++ i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_module_vec[i] );
 	m_module_vec[i]->elaboration_done( error );
     }
 }
@@ -133,6 +138,8 @@ void
 sc_module_registry::start_simulation()
 {
     for( int i = 0; i < size(); ++ i ) {
+	sc_elab_profiler::scope timer( m_simc->get_elab_profiler(),
+	                               *m_module_vec[i] );
 	m_module_vec[i]->start_simulation();
     }
 }
@@ -66,26 +66,43 @@ bool sc_enable_name_checking = true;
 //  Abstract base class of all SystemC `simulation' objects.
 // ----------------------------------------------------------------------------
 
+// children of objects without any
+static const std::vector<sc_event*>  no_child_events;
+static const std::vector<sc_object*> no_child_objects;
+
 void
 sc_object::add_child_event( sc_event* event_p )
 {
     // no check if event_p is already in the set
-    m_child_events.push_back( event_p );
+    if ( !m_children_p ) m_children_p = new children;
+    m_children_p->events.push_back( event_p );
 }
 
 void
 sc_object::add_child_object( sc_object* object_ )
 {
     // no check if object_ is already in the set
-    m_child_objects.push_back( object_ );
+    if ( !m_children_p ) m_children_p = new children;
+    m_children_p->objects.push_back( object_ );
+}
+
+const std::vector<sc_event*>&
+sc_object::get_child_events() const
+{
+    return m_children_p ? m_children_p->events : no_child_events;
+}
+
+const std::vector<sc_object*>&
+sc_object::get_child_objects() const
+{
+    return m_children_p ? m_children_p->objects : no_child_objects;
 }
 
 const char*
 sc_object::basename() const
 {
-    std::size_t pos; // position of last SC_HIERARCHY_CHAR.
-    pos = m_name.rfind( (char)SC_HIERARCHY_CHAR );
-    return ( pos == m_name.npos ) ? m_name.c_str() : &(m_name.c_str()[pos+1]);
+    const char* p = std::strrchr( m_name, SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : m_name;
 } 
 
 void
@@ -114,11 +131,13 @@ sc_object::dump(::std::ostream& os) const
 bool
 sc_object::remove_child_event( sc_event* event_p )
 {
-    int size = m_child_events.size();
+    if ( !m_children_p ) return false;
+    std::vector<sc_event*>& events = m_children_p->events;
+    int size = events.size();
     for( int i = 0; i < size; ++ i ) {
-        if( event_p == m_child_events[i] ) {
-            m_child_events[i] = m_child_events[size - 1];
-            m_child_events.pop_back();
+        if( event_p == events[i] ) {
+            events[i] = events[size - 1];
+            events.pop_back();
             return true;
         }
     }
@@ -138,11 +157,13 @@ sc_object::remove_child_event( sc_event* event_p )
 bool
 sc_object::remove_child_object( sc_object* object_p )
 {
-    int size = m_child_objects.size();
+    if ( !m_children_p ) return false;
+    std::vector<sc_object*>& objects = m_children_p->objects;
+    int size = objects.size();
     for( int i = 0; i < size; ++ i ) {
-        if( object_p == m_child_objects[i] ) {
-            m_child_objects[i] = m_child_objects[size - 1];
-            m_child_objects.pop_back();
+        if( object_p == objects[i] ) {
+            objects[i] = objects[size - 1];
+            objects.pop_back();
 	    object_p->m_parent = NULL;
             return true;
         }
@@ -174,12 +195,14 @@ sc_object::sc_object_init(const char* nm)
     // CONSTRUCT PATHNAME TO OBJECT BEING CREATED: 
 
     sc_assert( nm );
-    m_name = object_manager->create_name(nm);
+    std::string name = object_manager->create_name(nm);
 
 
     // PLACE THE OBJECT INTO THE HIERARCHY
+    //
+    // The object refers to the name interned by the object manager.
 
-    object_manager->insert_object(m_name, this);
+    m_name = object_manager->insert_object(name, this);
     if ( m_parent )
         m_parent->add_child_object( this );
     else
@@ -187,14 +210,14 @@ sc_object::sc_object_init(const char* nm)
 } 
 
 sc_object::sc_object() : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_children_p(0), m_name(""),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name("object") );
 }
 
 sc_object::sc_object( const sc_object& that ) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_children_p(0), m_name(""),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name( that.basename() ) );
@@ -208,7 +231,7 @@ object_name_illegal_char(char ch)
 }
 
 sc_object::sc_object(const char* nm) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_children_p(0), m_name(""),
     m_parent(0), m_simc(0)
 {
     int namebuf_alloc = 0;
@@ -258,6 +281,7 @@ sc_object::~sc_object()
 #endif
     detach();
     delete m_attr_cltn_p;
+    delete m_children_p;
 }
 
 //------------------------------------------------------------------------------
@@ -276,11 +300,16 @@ void sc_object::detach()
         object_manager->remove_object(m_name);
 
 		// REMOVE OBJECT FROM PARENT'S LIST OF OBJECTS:
-
-        if ( m_parent )
-	    m_parent->remove_child_object( this );
-	else
-	    m_simc->remove_child_object( this );
+		//
+		// Skipped in a fast teardown, where the parents are destroyed too.
+
+        if ( !m_simc->in_fast_teardown() )
+        {
+            if ( m_parent )
+                m_parent->remove_child_object( this );
+            else
+                m_simc->remove_child_object( this );
+        }
 
         // ORPHAN THIS OBJECT'S CHILDREN:
 
@@ -360,14 +389,14 @@ sc_object::add_attribute( sc_attr_base& attribute_ )
 sc_attr_base*
 sc_object::get_attribute( const std::string& name_ )
 {
-    if ( !m_attr_cltn_p ) m_attr_cltn_p = new sc_attr_cltn;
+    if ( !m_attr_cltn_p ) return 0;
     return ( (*m_attr_cltn_p)[name_] );
 }
 
 const sc_attr_base*
 sc_object::get_attribute( const std::string& name_ ) const
 {
-    if ( !m_attr_cltn_p ) m_attr_cltn_p = new sc_attr_cltn;
+    if ( !m_attr_cltn_p ) return 0;
     return ( (*m_attr_cltn_p)[name_] );
 }
 
@@ -71,7 +71,7 @@ public:
     typedef unsigned phase_cb_mask;
 
     const char* name() const
-        { return m_name.c_str(); }
+        { return m_name; }
 
     const char* basename() const;
 
@@ -107,11 +107,9 @@ public:
           sc_attr_cltn& attr_cltn();
     const sc_attr_cltn& attr_cltn() const;
 
-    virtual const std::vector<sc_event*>& get_child_events() const
-        { return m_child_events; }
+    virtual const std::vector<sc_event*>& get_child_events() const;
 
-    virtual const std::vector<sc_object*>& get_child_objects() const
-        { return m_child_objects; }
+    virtual const std::vector<sc_object*>& get_child_objects() const;
 
     sc_object* get_parent() const;
     sc_object* get_parent_object() const { return m_parent; }
@@ -148,11 +146,17 @@ private:
 
 private:
 
+    // children of an object, allocated with the first child.
+    struct children
+    {
+        std::vector<sc_event*>  events;  // list of child events.
+        std::vector<sc_object*> objects; // list of child objects.
+    };
+
     /* Each simulation object is associated with a simulation context */ 
     mutable sc_attr_cltn*   m_attr_cltn_p;   // attributes for this object.
-    std::vector<sc_event*>  m_child_events;  // list of child events.
-    std::vector<sc_object*> m_child_objects; // list of child objects.
-    std::string             m_name;          // name of this object.
+    children*               m_children_p;    // children or NULL.
+    const char*             m_name;          // name interned by the manager.
     sc_object*              m_parent;        // parent for this object.
     sc_simcontext*          m_simc;          // simcontext ptr / empty indicator
 };
@@ -33,6 +33,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cctype>
+#include <cstring>
 #include <algorithm> // pick up std::sort.
 
 #include "sysc/kernel/sc_object.h"
@@ -56,11 +57,11 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
-    m_event_walk_ok(0),
     m_instance_table(),
+    m_instance_sorted(0),
+    m_hash_table( 1024, static_cast<table_entry*>(NULL) ),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_it(0),
     m_object_stack(),
     m_object_walk_ok()
 {
@@ -71,19 +72,110 @@ sc_object_manager::sc_object_manager() :
 // | 
 // | This is the object instance destructor for this class. It goes through
 // | each sc_object instance in the instance table and sets its m_simc field
-// | to NULL.
+// | to NULL. The entries of these objects are not deleted, since the objects
+// | still refer to their names.
 // +----------------------------------------------------------------------------
 sc_object_manager::~sc_object_manager()
 {
-    instance_table_t::iterator it;     // instance table iterator.
-
-    for ( it = m_instance_table.begin(); it != m_instance_table.end(); it++) 
+    for ( std::size_t i = 0; i < m_instance_table.size(); i++ )
     {
-        if(it->second.m_name_origin == SC_NAME_OBJECT) {
-            sc_object* obj_p = static_cast<sc_object*>(it->second.m_element_p);
+        table_entry* entry_p = m_instance_table[i];
+        if(entry_p->m_name_origin == SC_NAME_OBJECT) {
+            sc_object* obj_p = static_cast<sc_object*>(entry_p->m_element_p);
             obj_p->m_simc = 0;
+            continue;
+        }
+        delete entry_p;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::hash_name"
+// |
+// | This method returns the hash value (FNV-1a) of the supplied name.
+// +----------------------------------------------------------------------------
+std::size_t
+sc_object_manager::hash_name(const char* name)
+{
+    std::size_t hash = 2166136261u;
+    while ( *name )
+    {
+        hash ^= static_cast<unsigned char>(*name++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::name_less"
+// |
+// | This method orders entries of the instance table by their names.
+// +----------------------------------------------------------------------------
+bool
+sc_object_manager::name_less(const table_entry* a, const table_entry* b)
+{
+    return a->m_name < b->m_name;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_entry"
+// |
+// | This method returns the entry of the instance table for the supplied
+// | name, or NULL if the name has never been inserted.
+// |
+// | Arguments:
+// |     name = name of the element
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry*
+sc_object_manager::find_entry(const char* name) const
+{
+    std::size_t  hash = hash_name(name);
+    table_entry* entry_p = m_hash_table[hash & (m_hash_table.size() - 1)];
+    while ( entry_p && (entry_p->m_hash != hash || entry_p->m_name != name) )
+    {
+        entry_p = entry_p->m_next_p;
+    }
+    return entry_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::insert_entry"
+// |
+// | This method returns the entry of the instance table for the supplied
+// | name, which is created if it does not exist. The number of hash buckets
+// | is doubled, once there are more entries than buckets.
+// |
+// | Arguments:
+// |     name = name of the element
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry&
+sc_object_manager::insert_entry(const std::string& name)
+{
+    table_entry* entry_p = find_entry(name.c_str());
+    if ( entry_p )
+        return *entry_p;
+
+    if ( m_instance_table.size() >= m_hash_table.size() )
+    {
+        instance_table_t buckets( 2 * m_hash_table.size(),
+                                  static_cast<table_entry*>(NULL) );
+        std::size_t mask = buckets.size() - 1;
+        for ( std::size_t i = 0; i < m_instance_table.size(); i++ )
+        {
+            table_entry* moved_p = m_instance_table[i];
+            moved_p->m_next_p = buckets[moved_p->m_hash & mask];
+            buckets[moved_p->m_hash & mask] = moved_p;
         }
+        m_hash_table.swap(buckets);
     }
+
+    entry_p = new table_entry(name, hash_name(name.c_str()));
+    table_entry*& bucket_p =
+        m_hash_table[entry_p->m_hash & (m_hash_table.size() - 1)];
+    entry_p->m_next_p = bucket_p;
+    bucket_p = entry_p;
+    m_instance_table.push_back(entry_p);
+    return *entry_p;
 }
 
 // +----------------------------------------------------------------------------
@@ -99,54 +191,37 @@ sc_object_manager::~sc_object_manager()
 // +----------------------------------------------------------------------------
 std::string sc_object_manager::create_name(const char* leaf_name) 
 { 
-    bool        clash;                  // true if path name exists in obj table
-    std::string leafname_string;        // string containing the leaf name.
-    std::string parentname_string;      // parent path name 
     sc_object*  parent_p;               // parent for this instance or NULL.
-    std::string result_orig_string;     // save for warning message.
+    std::size_t prefix_n;               // length of parent name and separator.
     std::string result_string;          // name to return.
  
     // CONSTRUCT PATHNAME TO THE NAME TO BE RETURNED:
-    // 
-    // If there is not a leaf name generate one. 
 
     parent_p = sc_get_curr_simcontext()->active_object();
-    parentname_string = parent_p ? parent_p->name() : ""; 
-    leafname_string = leaf_name; 
     if (parent_p) {
-        result_string = parentname_string;
+        std::size_t parentname_n = std::strlen(parent_p->m_name);
+        result_string.reserve( parentname_n + 1 + std::strlen(leaf_name) );
+        result_string.assign( parent_p->m_name, parentname_n );
 	result_string += SC_HIERARCHY_CHAR;
-	result_string += leafname_string;
-    } else { 
-        result_string = leafname_string;
-    } 
-
-    // SAVE the original path name 
-
-    result_orig_string = result_string;
+    }
+    prefix_n = result_string.size();
+    result_string += leaf_name;
 
     // MAKE SURE THE ENTITY NAME IS UNIQUE:
     // 
     // If not use unique name generator to make it unique. 
 
-    clash = false; 
-    for (;;)
+    if ( name_exists(result_string) )
     {
-	    if ( !name_exists(result_string) )
-	    {
-	        break;
-	    }
-        clash = true; 
-        leafname_string = sc_gen_unique_name(leafname_string.c_str(), false); 
-	if (parent_p) {
-	    result_string = parentname_string;
-	    result_string += SC_HIERARCHY_CHAR;
-	    result_string += leafname_string;
-	} else { 
-	    result_string = leafname_string;
-	} 
-    } 
-    if (clash) { 
+        std::string result_orig_string = result_string;
+        std::string leafname_string = leaf_name;
+        do {
+            leafname_string =
+                sc_gen_unique_name(leafname_string.c_str(), false);
+            result_string.replace( prefix_n, std::string::npos,
+                                   leafname_string );
+        } while ( name_exists(result_string) );
+
 	std::string message = result_orig_string;
 	message += ". Latter declaration will be renamed to ";
 	message += result_string;
@@ -169,9 +244,8 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 bool
 sc_object_manager::name_exists(const std::string& name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
-    return (it != m_instance_table.end()) &&
-           (it->second.m_name_origin != SC_NAME_NONE);
+    table_entry* entry_p = find_entry(name.c_str());
+    return entry_p && entry_p->m_name_origin != SC_NAME_NONE;
 }
 
 // +----------------------------------------------------------------------------
@@ -187,10 +261,9 @@ sc_object_manager::name_exists(const std::string& name)
 const char*
 sc_object_manager::get_name(const std::string& name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
-    if (it != m_instance_table.end() &&
-        it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
+    table_entry* entry_p = find_entry(name.c_str());
+    if (entry_p && entry_p->m_name_origin != SC_NAME_NONE) {
+        return entry_p->m_name.c_str();
     } else {
         return NULL;
     }
@@ -209,12 +282,10 @@ sc_object_manager::get_name(const std::string& name)
 sc_event*
 sc_object_manager::find_event(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        return static_cast<sc_event*>(it->second.m_element_p);
+        return static_cast<sc_event*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -233,12 +304,10 @@ sc_object_manager::find_event(const char* name)
 sc_object*
 sc_object_manager::find_object(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        return static_cast<sc_object*>(it->second.m_element_p);
+        return static_cast<sc_object*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -250,24 +319,33 @@ sc_object_manager::find_object(const char* name)
 // | 
 // | This method initializes the object iterator to point to the first object
 // | in the instance table, and returns its address. If there are no objects
-// | in the table a NULL value is returned.
+// | in the table a NULL value is returned. Objects are visited in the order
+// | of their names: the entries inserted since the last walk are sorted and
+// | merged into the sorted part of the table.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::first_object()
 {
-    sc_object* result_p; // result to return.
+    if ( m_instance_sorted != m_instance_table.size() )
+    {
+        instance_table_t::iterator middle =
+            m_instance_table.begin() + m_instance_sorted;
+        std::sort( middle, m_instance_table.end(), name_less );
+        std::inplace_merge( m_instance_table.begin(), middle,
+                            m_instance_table.end(), name_less );
+        m_instance_sorted = m_instance_table.size();
+    }
 
     m_object_walk_ok = true;
-    result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    for ( m_object_it = 0; m_object_it != m_instance_table.size();
+          m_object_it++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        table_entry* entry_p = m_instance_table[m_object_it];
+        if(entry_p->m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry_p->m_element_p);
         }
     }
-    return result_p;
+    return NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -344,12 +422,12 @@ sc_object_manager::hierarchy_size()
 bool
 sc_object_manager::insert_external_name(const std::string& name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    table_entry& element = insert_entry(name);
+    if(element.m_name_origin == SC_NAME_NONE) {
+        element.m_element_p = NULL;
+        element.m_name_origin = SC_NAME_EXTERNAL;
         return true;
     } else {
-        table_entry element = m_instance_table[name];
         std::stringstream msg;
         msg << name << " ("
             << ((element.m_name_origin == SC_NAME_OBJECT)
@@ -371,12 +449,32 @@ sc_object_manager::insert_external_name(const std::string& name)
 // | Arguments:
 // |     name    =  name of the event to be inserted.
 // |     event_p -> event to be inserted.
+// | Result is the interned name of the event.
 // +----------------------------------------------------------------------------
-void
+const char*
 sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    table_entry& element = insert_entry(name);
+    element.m_element_p = static_cast<void*>(event_p);
+    element.m_name_origin = SC_NAME_EVENT;
+    return element.m_name.c_str();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::intern_name"
+// | 
+// | This method returns the interned copy of the supplied name, without
+// | inserting an element into the hierarchy. Kernel events are named this
+// | way, elements with the same name can still be inserted.
+// |
+// | Arguments:
+// |     name = name to be interned.
+// | Result is the interned name.
+// +----------------------------------------------------------------------------
+const char*
+sc_object_manager::intern_name(const std::string& name)
+{
+    return insert_entry(name).m_name.c_str();
 }
 
 // +----------------------------------------------------------------------------
@@ -388,12 +486,15 @@ sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 // | Arguments:
 // |     name     =  name of the event to be inserted.
 // |     object_p -> object to be inserted.
+// | Result is the interned name of the object.
 // +----------------------------------------------------------------------------
-void
+const char*
 sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    table_entry& element = insert_entry(name);
+    element.m_element_p = static_cast<void*>(object_p);
+    element.m_name_origin = SC_NAME_OBJECT;
+    return element.m_name.c_str();
 }
 
 // +----------------------------------------------------------------------------
@@ -404,21 +505,19 @@ sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 sc_object*
 sc_object_manager::next_object()
 {
-    sc_object* result_p; // result to return.
-
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
+    if ( m_object_it == m_instance_table.size() ) return NULL;
     m_object_it++;
 
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    for ( ; m_object_it != m_instance_table.size(); m_object_it++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        table_entry* entry_p = m_instance_table[m_object_it];
+        if(entry_p->m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry_p->m_element_p);
         }
     }
-    return result_p;
+    return NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -475,15 +574,13 @@ sc_object_manager::top_of_module_name_stack()
 // |     name = name of the event to be removed.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_event(const std::string& name)
+sc_object_manager::remove_event(const char* name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -497,15 +594,13 @@ sc_object_manager::remove_event(const std::string& name)
 // |     name = name of the object to be removed.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_object(const std::string& name)
+sc_object_manager::remove_object(const char* name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
     }
 }
 
@@ -521,13 +616,11 @@ sc_object_manager::remove_object(const std::string& name)
 bool
 sc_object_manager::remove_external_name(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EXTERNAL)
+    table_entry* entry_p = find_entry(name.c_str());
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EXTERNAL)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_NONE;
         return true;
     } else {
         return false;
@@ -30,7 +30,7 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <string>
 #include <vector>
 
 namespace sc_core {
@@ -61,17 +61,26 @@ protected:
         SC_NAME_EXTERNAL
     };
 
+    // Names are interned: the entry of a name is kept, once the element is
+    // removed, so that the name returned by get_name() remains valid.
+    // Objects and events refer to the names of their entries.
+
     struct table_entry
     {
-        table_entry() : m_element_p(NULL), m_name_origin(SC_NAME_NONE) {}
+        table_entry( const std::string& name, std::size_t hash )
+          : m_name(name), m_hash(hash), m_next_p(NULL),
+            m_element_p(NULL), m_name_origin(SC_NAME_NONE) {}
 
+        std::string    m_name;      // hierarchical name.
+        std::size_t    m_hash;      // hash value of the name.
+        table_entry*   m_next_p;    // next entry in the same hash bucket.
 	    void*          m_element_p; // can be an sc_object or an sc_event
         sc_name_origin m_name_origin;
     };
 
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
-    typedef std::vector<sc_object*>           object_vector_t;
+    typedef std::vector<table_entry*> instance_table_t;
+    typedef std::vector<sc_object*>   object_vector_t;
 
     sc_object_manager();
     ~sc_object_manager();
@@ -96,21 +105,27 @@ public:
 
 
 private:
+    static std::size_t hash_name( const char* name );
+    static bool name_less( const table_entry* a, const table_entry* b );
+    table_entry* find_entry( const char* name ) const;
+    table_entry& insert_entry( const std::string& name );
+
     std::string create_name( const char* leaf_name );
-    void insert_event(const std::string& name, sc_event* obj);
-    void insert_object(const std::string& name, sc_object* obj);
+    const char* insert_event(const std::string& name, sc_event* obj);
+    const char* intern_name(const std::string& name);
+    const char* insert_object(const std::string& name, sc_object* obj);
     bool insert_external_name(const std::string& name);
-    void remove_event(const std::string& name);
-    void remove_object(const std::string& name);
+    void remove_event(const char* name);
+    void remove_object(const char* name);
     bool remove_external_name(const std::string& name);
 
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
-    bool                       m_event_walk_ok;     // true if can walk events.
-    instance_table_t           m_instance_table;    // table of instances.
+    instance_table_t           m_instance_table;    // instances.
+    std::size_t                m_instance_sorted;   // leading ones by name.
+    instance_table_t           m_hash_table;        // hash buckets of names.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    std::size_t                m_object_it;         // object instance iterator.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
 };
@@ -0,0 +1,139 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_offload.h -- Offloading of host computations from thread processes
+
+  sc_offload() executes a pure computation on a pool of host threads while
+  the calling SC_THREAD is suspended.  Other processes continue to run in
+  the meantime.  At the end of the evaluation phase, the simulator waits
+  for all computations offloaded during the phase and resumes their callers
+  in the next delta cycle.  Hence, simulated time and the order of process
+  activations are the same as if the computation had been executed in
+  place, followed by a wait(SC_ZERO_TIME).
+
+  An offloaded computation shall neither access channels, events or
+  processes nor call any other function of the simulation kernel.
+
+ *****************************************************************************/
+
+#ifndef SC_OFFLOAD_H_INCLUDED_
+#define SC_OFFLOAD_H_INCLUDED_
+
+#include "sysc/kernel/sc_host_atomic.h"
+
+#include <string>
+
+namespace sc_core {
+
+class sc_event;
+class sc_offload_pool;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_offload_job
+//
+//  Abstract base class of computations executed by sc_offload().
+// ----------------------------------------------------------------------------
+
+class SC_API sc_offload_job
+{
+    friend class sc_offload_pool;
+
+public:
+
+    sc_offload_job()
+      : m_done_p( 0 ), m_finished( false ), m_failed( false ), m_error()
+    {}
+
+    virtual ~sc_offload_job() {}
+
+    // the computation, called once on an arbitrary host thread
+    virtual void execute() = 0;
+
+private:
+    sc_event*            m_done_p;   // notified upon completion.
+    sc_host_atomic<bool> m_finished; // execute() has returned.
+    bool                 m_failed;   // execute() has thrown.
+    std::string          m_error;    // message of the exception.
+
+private:
+    // disabled
+    sc_offload_job( const sc_offload_job& );
+    sc_offload_job& operator = ( const sc_offload_job& );
+};
+
+//=============================================================================
+// CLASS sc_offload_object<T>
+//
+// This templated helper class allows an object to provide the computation
+// of sc_offload() via its () operator.  The () operator does not return a
+// value, results are passed by reference (e.g., via sc_bind and sc_ref).
+//=============================================================================
+template<typename T>
+class sc_offload_object : public sc_offload_job
+{
+  public:
+    explicit sc_offload_object( T object ) : m_object( object )
+    {}
+
+    virtual void execute()
+    {
+        m_object();
+    }
+
+  protected:
+    T m_object;
+};
+
+//------------------------------------------------------------------------------
+//"sc_offload_execute"
+//
+// This function executes a computation on the host thread pool and suspends
+// the calling thread process until the next delta cycle after the end of the
+// current evaluation phase.  Called from outside of a thread process, the
+// computation is executed immediately.  An exception escaping the computation
+// is reported as an error in the context of the caller.
+//------------------------------------------------------------------------------
+extern SC_API void sc_offload_execute( sc_offload_job& job );
+
+//------------------------------------------------------------------------------
+//"sc_offload"
+//
+// This inline function executes the () operator of an object (e.g., an
+// sc_bind bound function) on the host thread pool, see sc_offload_execute().
+//------------------------------------------------------------------------------
+template <typename T>
+inline void sc_offload( T object )
+{
+    sc_offload_object<T> job( object );
+    sc_offload_execute( job );
+}
+
+// number of host threads executing offloaded computations, 0 to execute
+// them on the simulator's thread.  The default is taken from the
+// environment variable SC_OFFLOAD_THREADS (a number or "AUTO", default).
+extern SC_API void sc_set_offload_threads( unsigned threads );
+extern SC_API unsigned sc_get_offload_threads();
+
+} // namespace sc_core
+
+#endif // SC_OFFLOAD_H_INCLUDED_
+
+// Taf!
@@ -0,0 +1,261 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_offload_pool.cpp -- Work-stealing pool of host threads for sc_offload()
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_offload_pool.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <algorithm> // std::find
+#include <exception>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_offload_pool::worker
+//
+//  Host thread of the pool and its queue of jobs.
+// ----------------------------------------------------------------------------
+
+struct sc_offload_pool::worker
+{
+    worker( sc_offload_pool* owner_p, std::size_t index_ )
+      : owner( owner_p ), index( index_ ), thread(), mutex(), queue()
+    {}
+
+    sc_offload_pool*            owner;  // pool owning the worker.
+    std::size_t                 index;  // index within the pool.
+    sc_host_thread              thread; // host thread (unused for [0]).
+    sc_host_mutex               mutex;  // protects the queue.
+    std::deque<sc_offload_job*> queue;  // queued jobs.
+};
+
+sc_offload_pool::sc_offload_pool( unsigned threads )
+  : m_simc( sc_get_curr_simcontext() )
+  , m_workers(), m_jobs(), m_next( 0 ), m_shutdown( false )
+  , m_queued( 0 ), m_finished( 0 )
+{
+    m_workers.push_back( new worker( this, 0 ) );
+    while( m_workers.size() <= threads )
+    {
+        worker* worker_p = new worker( this, m_workers.size() );
+        if( !worker_p->thread.start( &worker_fn, worker_p ) ) {
+            delete worker_p;
+            break;
+        }
+        m_workers.push_back( worker_p );
+    }
+}
+
+sc_offload_pool::~sc_offload_pool()
+{
+    // outstanding jobs may refer to the stacks of their callers
+    while( !m_jobs.empty() ) {
+        cancel( *m_jobs.back() );
+    }
+
+    m_shutdown.store( true );
+    for( std::size_t i = 1; i < m_workers.size(); ++i ) {
+        m_queued.post();
+    }
+    for( std::size_t i = 0; i < m_workers.size(); ++i ) {
+        m_workers[i]->thread.join();
+        delete m_workers[i];
+    }
+}
+
+void
+sc_offload_pool::worker_fn( void* arg )
+{
+    worker* worker_p = static_cast<worker*>( arg );
+    sc_offload_pool* owner_p = worker_p->owner;
+
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+    sc_set_curr_simcontext( owner_p->m_simc );
+#endif
+    for(;;)
+    {
+        owner_p->m_queued.wait();
+        if( owner_p->m_shutdown.load() )
+            break;
+        run( *owner_p->take( worker_p->index ) );
+        owner_p->m_finished.post();
+    }
+}
+
+void
+sc_offload_pool::run( sc_offload_job& job )
+{
+    try {
+        job.execute();
+    }
+    catch( const std::exception& x ) {
+        job.m_failed = true;
+        job.m_error  = x.what();
+    }
+    catch( ... ) {
+        job.m_failed = true;
+        job.m_error  = "unknown exception";
+    }
+    job.m_finished.store( true );
+}
+
+sc_offload_job*
+sc_offload_pool::take( std::size_t first )
+{
+    // The caller holds a token of m_queued, so there is at least one job
+    // left in some queue, even if other threads steal concurrently.
+
+    std::size_t n = m_workers.size();
+    for(;;)
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            worker& w = *m_workers[ ( first + i ) % n ];
+            sc_scoped_lock lock( w.mutex );
+            if( w.queue.empty() )
+                continue;
+
+            sc_offload_job* job_p;
+            if( i == 0 ) { // own queue, oldest job first
+                job_p = w.queue.front();
+                w.queue.pop_front();
+            } else {       // steal the newest job
+                job_p = w.queue.back();
+                w.queue.pop_back();
+            }
+            return job_p;
+        }
+    }
+}
+
+void
+sc_offload_pool::help_or_wait()
+{
+    if( m_queued.trywait() == 0 ) {
+        run( *take( 0 ) );
+    } else {
+        m_finished.wait();
+    }
+}
+
+void
+sc_offload_pool::submit( sc_offload_job& job )
+{
+    // distribute over the host threads, if any
+    std::size_t n = m_workers.size();
+    std::size_t index = 0;
+    if( n > 1 ) {
+        index = 1 + m_next;
+        m_next = ( m_next + 1 ) % ( n - 1 );
+    }
+
+    m_jobs.push_back( &job );
+    {
+        worker& w = *m_workers[index];
+        sc_scoped_lock lock( w.mutex );
+        w.queue.push_back( &job );
+    }
+    m_queued.post();
+}
+
+void
+sc_offload_pool::complete()
+{
+    for( std::size_t i = 0; i < m_jobs.size(); ++i )
+    {
+        sc_offload_job& job = *m_jobs[i];
+        while( !job.m_finished.load() ) {
+            help_or_wait();
+        }
+        if( job.m_done_p ) {
+            job.m_done_p->notify( SC_ZERO_TIME );
+        }
+    }
+    m_jobs.clear();
+
+    // discard the tokens of jobs, which have not been waited for
+    while( m_finished.trywait() == 0 ) {}
+}
+
+void
+sc_offload_pool::cancel( sc_offload_job& job )
+{
+    std::vector<sc_offload_job*>::iterator it =
+      std::find( m_jobs.begin(), m_jobs.end(), &job );
+    if( it == m_jobs.end() )
+        return;
+
+    m_jobs.erase( it );
+    while( !job.m_finished.load() ) {
+        help_or_wait();
+    }
+}
+
+void
+sc_offload_pool::execute( sc_offload_job& job )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    sc_curr_proc_handle cpi = simc_p->get_curr_proc_info();
+
+    if( cpi->kind != SC_THREAD_PROC_ )
+    {
+        run( job );
+    }
+    else
+    {
+        sc_event done( sc_event::kernel_event, "offload_done" );
+        sc_offload_pool* pool_p = simc_p->get_offload_pool();
+
+        job.m_done_p = &done;
+        pool_p->submit( job );
+        try {
+            sc_core::wait( done, simc_p );
+        }
+        catch( ... ) {
+            pool_p->cancel( job );
+            throw;
+        }
+    }
+
+    if( job.m_failed ) {
+        SC_REPORT_ERROR( SC_ID_OFFLOAD_FAILED_, job.m_error.c_str() );
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  sc_offload_execute
+// ----------------------------------------------------------------------------
+
+SC_API void
+sc_offload_execute( sc_offload_job& job )
+{
+    sc_offload_pool::execute( job );
+}
+
+} // namespace sc_core
+
+// Taf!
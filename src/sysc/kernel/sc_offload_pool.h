@@ -0,0 +1,117 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_offload_pool.h -- Work-stealing pool of host threads for sc_offload()
+
+  Jobs are distributed round-robin over per-thread queues.  A host thread
+  executes the jobs of its own queue in submission order and steals from
+  the other queues, once its own queue is empty.  While waiting for the
+  completion of jobs, the simulator's thread executes queued jobs as well.
+
+  The number of queued jobs is mirrored by a semaphore, so idle host
+  threads block instead of polling the queues.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_OFFLOAD_POOL_H_INCLUDED_
+#define SC_OFFLOAD_POOL_H_INCLUDED_
+
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/kernel/sc_offload.h"
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_host_semaphore.h"
+
+#include <deque>
+#include <vector>
+
+namespace sc_core {
+
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_offload_pool
+//
+//  Pool of host threads executing offloaded computations.
+// ----------------------------------------------------------------------------
+
+class sc_offload_pool
+{
+public:
+
+    explicit sc_offload_pool( unsigned threads );
+    ~sc_offload_pool();
+
+    // number of host threads (without the simulator's thread)
+    unsigned threads() const
+        { return static_cast<unsigned>( m_workers.size() ); }
+
+    // are there jobs submitted since the last call of complete()?
+    bool outstanding() const
+        { return !m_jobs.empty(); }
+
+    // queue a job, called by the simulator's thread
+    void submit( sc_offload_job& );
+
+    // wait for all outstanding jobs and notify their completion events
+    void complete();
+
+    // wait for a single job and forget about it (e.g., if its caller is
+    // killed while waiting)
+    void cancel( sc_offload_job& );
+
+    // execute a job on the calling (simulator) thread, see sc_offload_execute
+    static void execute( sc_offload_job& );
+
+private:
+
+    struct worker;
+
+    static void worker_fn( void* );
+    static void run( sc_offload_job& );
+
+    // take a queued job (own queue first), requires a token of m_queued
+    sc_offload_job* take( std::size_t first );
+
+    // execute a queued job or block until the next job has finished
+    void help_or_wait();
+
+private:
+    sc_simcontext*               m_simc;       // context of the workers.
+    std::vector<worker*>         m_workers;    // host threads and queues.
+    std::vector<sc_offload_job*> m_jobs;       // outstanding jobs.
+    std::size_t                  m_next;       // next queue to submit to.
+    sc_host_atomic<bool>         m_shutdown;   // terminate the workers.
+    sc_host_semaphore            m_queued;     // # of queued jobs.
+    sc_host_semaphore            m_finished;   // posted per finished job.
+
+private:
+    // disabled
+    sc_offload_pool( const sc_offload_pool& );
+    sc_offload_pool& operator = ( const sc_offload_pool& );
+};
+
+} // namespace sc_core
+
+#endif // SC_OFFLOAD_POOL_H_INCLUDED_
+
+// Taf!
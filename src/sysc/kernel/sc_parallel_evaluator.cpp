@@ -0,0 +1,284 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.cpp -- Parallel execution of method processes
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/utils/sc_report_handler.h"
+
+#include <string>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_parallel_evaluator::report
+//
+//  Report of a parallel-safe method process, issued after the batch.
+// ----------------------------------------------------------------------------
+
+struct sc_parallel_evaluator::report
+{
+    sc_process_b* process;   // reporting method process.
+    sc_severity   severity;  // severity of the report.
+    int           id;        // id of the 2.0 API, msg_type if negative.
+    std::string   msg_type;  // message type.
+    std::string   msg;       // message.
+    int           verbosity; // verbosity of an info.
+    std::string   file;      // source location.
+    int           line;      // source location.
+};
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_parallel_evaluator::worker
+//
+//  Per host thread state of the parallel evaluator.
+// ----------------------------------------------------------------------------
+
+struct sc_parallel_evaluator::worker
+{
+    worker( sc_parallel_evaluator* owner_p )
+      : owner( owner_p ), thread(), start(), curr_proc(), updates()
+      , reports(), begin( 0 ), end( 0 ), error( 0 )
+    {}
+
+    sc_parallel_evaluator*        owner;     // evaluator owning the worker.
+    sc_host_thread                thread;    // host thread (unused for [0]).
+    sc_host_semaphore             start;     // posted to start a chunk.
+    sc_curr_proc_info             curr_proc; // process currently executed.
+    std::vector<sc_prim_channel*> updates;   // deferred update requests.
+    std::vector<report>           reports;   // deferred reports.
+    std::size_t                   begin;     // first method of the chunk.
+    std::size_t                   end;       // end of the chunk.
+    sc_report*                    error;     // first error within the chunk.
+};
+
+SC_HOST_THREAD_LOCAL_ sc_parallel_evaluator::worker*
+sc_parallel_evaluator::m_curr_worker = 0;
+
+sc_parallel_evaluator::sc_parallel_evaluator( unsigned threads )
+  : m_simc( sc_get_curr_simcontext() )
+  , m_threads( 1 ), m_active( 0 ), m_shutdown( false )
+  , m_workers(), m_batch(), m_done(), m_error_mutex()
+{
+    m_workers.push_back( new worker( this ) );
+    while( m_threads < threads )
+    {
+        worker* worker_p = new worker( this );
+        if( !worker_p->thread.start( &worker_fn, worker_p ) ) {
+            delete worker_p;
+            break;
+        }
+        m_workers.push_back( worker_p );
+        m_threads++;
+    }
+}
+
+sc_parallel_evaluator::~sc_parallel_evaluator()
+{
+    m_shutdown = true;
+    for( unsigned i = 1; i < m_workers.size(); ++i ) {
+        m_workers[i]->start.post();
+    }
+    for( unsigned i = 0; i < m_workers.size(); ++i ) {
+        m_workers[i]->thread.join();
+        delete m_workers[i];
+    }
+}
+
+void
+sc_parallel_evaluator::worker_fn( void* arg )
+{
+    worker* worker_p = static_cast<worker*>( arg );
+    sc_parallel_evaluator* owner_p = worker_p->owner;
+
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+    sc_set_curr_simcontext( owner_p->m_simc );
+#endif
+    for(;;)
+    {
+        worker_p->start.wait();
+        if( owner_p->m_shutdown )
+            break;
+        owner_p->execute( *worker_p );
+        owner_p->m_done.post();
+    }
+}
+
+void
+sc_parallel_evaluator::execute( worker& w )
+{
+    m_curr_worker = &w;
+    for( std::size_t i = w.begin; i < w.end; ++i )
+    {
+        sc_method_handle method_h = m_batch[i];
+        w.curr_proc.process_handle = method_h;
+        w.curr_proc.kind           = method_h->proc_kind();
+        try {
+            method_h->semantics();
+        }
+        catch( ... ) {
+            m_error_mutex.lock();
+            w.error = sc_handle_exception();
+            m_error_mutex.unlock();
+            break;
+        }
+    }
+    w.curr_proc.process_handle = 0;
+    w.curr_proc.kind           = SC_NO_PROC_;
+    m_curr_worker = 0;
+}
+
+void
+sc_parallel_evaluator::run()
+{
+    std::size_t size = m_batch.size();
+    m_active = ( size < m_threads ) ? static_cast<unsigned>( size )
+                                    : m_threads;
+
+    // split the batch into contiguous chunks of (almost) equal size
+
+    for( unsigned i = 0; i < m_active; ++i )
+    {
+        worker& w = *m_workers[i];
+        w.begin = size * i / m_active;
+        w.end   = size * ( i + 1 ) / m_active;
+        w.error = 0;
+        w.updates.clear();
+        w.reports.clear();
+    }
+
+    for( unsigned i = 1; i < m_active; ++i ) {
+        m_workers[i]->start.post();
+    }
+    execute( *m_workers[0] );
+    for( unsigned i = 1; i < m_active; ++i ) {
+        m_done.wait();
+    }
+}
+
+sc_report*
+sc_parallel_evaluator::commit()
+{
+    sc_report* error_p = 0;
+    for( unsigned i = 0; i < m_active; ++i )
+    {
+        worker& w = *m_workers[i];
+        for( std::size_t u = 0; u < w.updates.size(); ++u ) {
+            w.updates[u]->request_update();
+        }
+        // the reports precede an error of the chunk, skip them after one
+        for( std::size_t r = 0; r < w.reports.size() && !error_p; ++r ) {
+            error_p = issue( w.reports[r] );
+        }
+        w.reports.clear();
+        if( w.error ) {
+            if( error_p ) {
+                delete w.error;
+            } else {
+                error_p = w.error;
+            }
+            w.error = 0;
+        }
+    }
+    m_active = 0;
+    m_batch.clear();
+    return error_p;
+}
+
+sc_curr_proc_handle
+sc_parallel_evaluator::curr_proc_info()
+{
+    return m_curr_worker ? &m_curr_worker->curr_proc : 0;
+}
+
+bool
+sc_parallel_evaluator::defer_update( sc_prim_channel& prim_channel_ )
+{
+    if( !m_curr_worker )
+        return false;
+    m_curr_worker->updates.push_back( &prim_channel_ );
+    return true;
+}
+
+bool
+sc_parallel_evaluator::defer_report( sc_severity severity, const char* msg_type,
+                                     const char* msg, int verbosity,
+                                     const char* file, int line )
+{
+    if( !m_curr_worker )
+        return false;
+    report r;
+    r.process   = m_curr_worker->curr_proc.process_handle;
+    r.severity  = severity;
+    r.id        = -1;
+    r.msg_type  = msg_type ? msg_type : SC_ID_UNKNOWN_ERROR_;
+    r.msg       = msg ? msg : "";
+    r.verbosity = verbosity;
+    r.file      = file ? file : "";
+    r.line      = line;
+    m_curr_worker->reports.push_back( r );
+    return true;
+}
+
+bool
+sc_parallel_evaluator::defer_report( sc_severity severity, int id,
+                                     const char* msg,
+                                     const char* file, int line )
+{
+    if( !defer_report( severity, 0, msg, SC_MEDIUM, file, line ) )
+        return false;
+    m_curr_worker->reports.back().id = id;
+    return true;
+}
+
+// issue a deferred report on the simulator's thread, returns the error
+// thrown by it (or 0)
+sc_report*
+sc_parallel_evaluator::issue( const report& r )
+{
+    sc_report* error_p = 0;
+    m_simc->set_curr_proc( r.process );
+    try {
+        if( r.id >= 0 ) {
+            sc_report_handler::report( r.severity, r.id, r.msg.c_str(),
+                                       r.file.c_str(), r.line );
+        } else {
+            sc_report_handler::report( r.severity, r.msg_type.c_str(),
+                                       r.msg.c_str(), r.verbosity,
+                                       r.file.c_str(), r.line );
+        }
+    }
+    catch( ... ) {
+        error_p = sc_handle_exception();
+    }
+    m_simc->reset_curr_proc();
+    return error_p;
+}
+
+} // namespace sc_core
+
+// Taf!
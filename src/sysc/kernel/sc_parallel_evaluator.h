@@ -0,0 +1,136 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.h -- Parallel execution of method processes
+
+  Runs a batch of method processes, which have been marked as parallel-safe
+  via set_parallel_safe(), on a pool of host threads during the evaluation
+  phase.  The batch is split into contiguous chunks, one per host thread.
+
+  Update requests issued during the batch are collected per chunk and
+  committed in batch order afterwards.  Hence, the update phase observes
+  exactly the same sequence of requests as in a sequential evaluation.
+
+  A parallel-safe method process shall only read from channels and write to
+  primitive channels (e.g., sc_signal).  It shall neither notify events,
+  call next_trigger(), nor create or control other processes.  Event
+  notifications and next_trigger() are rejected with an error.
+
+  Reports issued during the batch are recorded as well and issued in batch
+  order afterwards, with the reporting method as the current process.  The
+  report actions apply only then, i.e., SC_THROW does not end the method.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_PARALLEL_EVALUATOR_H_INCLUDED_
+#define SC_PARALLEL_EVALUATOR_H_INCLUDED_
+
+#include "sysc/kernel/sc_host_thread.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/utils/sc_report.h"
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/communication/sc_host_semaphore.h"
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_prim_channel;
+class sc_report;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_evaluator
+//
+//  Pool of host threads executing batches of parallel-safe method processes.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_evaluator
+{
+public:
+
+    explicit sc_parallel_evaluator( unsigned threads );
+    ~sc_parallel_evaluator();
+
+    // number of host threads in use, including the simulator's thread
+    unsigned threads() const
+        { return m_threads; }
+
+    // method processes to be executed by the next call of run()
+    std::vector<sc_method_handle>& batch()
+        { return m_batch; }
+
+    // execute the current batch of method processes
+    void run();
+
+    // commit the update requests and issue the reports of the last batch
+    // in batch order, returns the first error in batch order (or 0)
+    sc_report* commit();
+
+    // process information of the calling host thread within run() (or 0)
+    static sc_curr_proc_handle curr_proc_info();
+
+    // record an update request of the calling host thread within run(),
+    // returns false if called from outside of run()
+    static bool defer_update( sc_prim_channel& );
+
+    // record a report of the calling host thread within run(),
+    // returns false if called from outside of run()
+    static bool defer_report( sc_severity, const char* msg_type,
+                              const char* msg, int verbosity,
+                              const char* file, int line );
+    static bool defer_report( sc_severity, int id, const char* msg,
+                              const char* file, int line );
+
+private:
+
+    struct report;
+    struct worker;
+
+    static void worker_fn( void* );
+    void execute( worker& );
+    sc_report* issue( const report& );
+
+    // worker of the calling host thread, while executing a chunk
+    static SC_HOST_THREAD_LOCAL_ worker* m_curr_worker;
+
+private:
+    sc_simcontext*                m_simc;     // context of the workers.
+    unsigned                      m_threads;  // # of host threads in use.
+    unsigned                      m_active;   // # of chunks in last batch.
+    bool                          m_shutdown; // terminate the worker threads.
+    std::vector<worker*>          m_workers;  // m_workers[0]: own thread.
+    std::vector<sc_method_handle> m_batch;    // methods to execute.
+    sc_host_semaphore             m_done;     // posted by finished workers.
+    sc_host_mutex                 m_error_mutex; // serializes error reports.
+
+private:
+    // disabled
+    sc_parallel_evaluator( const sc_parallel_evaluator& );
+    sc_parallel_evaluator& operator = ( const sc_parallel_evaluator& );
+};
+
+} // namespace sc_core
+
+#endif // SC_PARALLEL_EVALUATOR_H_INCLUDED_
+
+// Taf!
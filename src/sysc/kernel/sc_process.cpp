@@ -35,6 +35,7 @@
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_sensitive.h"
 #include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_process_profiler.h"
 #include "sysc/kernel/sc_event.h"
 #include <sstream>
 
@@ -51,7 +52,7 @@ sc_event                sc_process_handle::non_event( sc_event::kernel_event );
 
 // Last process that was created:
 
-sc_process_b* sc_process_b::m_last_created_process_p = 0;
+SC_CONTEXT_LOCAL_ sc_process_b* sc_process_b::m_last_created_process_p = 0;
 
 //------------------------------------------------------------------------------
 //"sc_process_b::add_static_event"
@@ -274,7 +275,7 @@ sc_process_b::remove_dynamic_events( bool skip_timeout )
         if ( m_event_list_p )
         {
             m_event_list_p->remove_dynamic( thread_h, 0 );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
         }
         break;
@@ -292,7 +293,7 @@ sc_process_b::remove_dynamic_events( bool skip_timeout )
         if ( m_event_list_p )
         {
             m_event_list_p->remove_dynamic( method_h, 0 );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
         }
         break;
@@ -558,6 +559,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_event_count(0),
     m_event_list_p(0),
     m_exist_p(0),
+    m_free_event_lists(),
     m_free_host( free_host ),
     m_has_reset_signal( false ),
     m_has_stack(false),
@@ -565,6 +567,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_last_report_p(0),
     m_name_gen_p(0),
     m_process_kind(SC_NO_PROC_),
+    m_profile(),
     m_references_n(1),
     m_resets(),
     m_reset_event_p(0),
@@ -603,6 +606,12 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
 sc_process_b::~sc_process_b()
 {
 
+    // KEEP THE EXECUTION PROFILE IF PROCESS PROFILING IS ENABLED:
+
+    if ( simcontext()->m_process_profiler )
+        simcontext()->m_process_profiler->retire( this );
+
+
     // REDIRECT ANY CHILDREN AS CHILDREN OF THE SIMULATION CONTEXT:
 
     orphan_child_objects();
@@ -625,6 +634,8 @@ sc_process_b::~sc_process_b()
     delete m_term_event_p;
     delete m_throw_helper_p;
     delete m_timeout_event_p;
+    delete m_free_event_lists[0];
+    delete m_free_event_lists[1];
 
 }
 
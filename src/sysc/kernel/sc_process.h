@@ -34,6 +34,7 @@
 #include "sysc/kernel/sc_constants.h"
 #include "sysc/kernel/sc_object.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_process_profile.h"
 #include "sysc/communication/sc_export.h"
 
 #if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
@@ -279,8 +280,10 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_thread_process;  // Child can access parent.
 
     friend class sc_event;
+    friend class sc_event_list;
     friend class sc_object;
     friend class sc_port_base;
+    friend class sc_process_profiler;
     friend class sc_runnable;
     friend class sc_sensitive;
     friend class sc_sensitive_pos;
@@ -430,6 +433,7 @@ class SC_API sc_process_b : public sc_object {
     int                          m_event_count;     // number of events.
     const sc_event_list*         m_event_list_p;    // event list waiting on.
     sc_process_b*                m_exist_p;         // process existence link.
+    sc_event_list*               m_free_event_lists[2]; // reusable OR/AND list.
     bool                         m_free_host;       // free sc_semantic_host_p.
     bool                         m_has_reset_signal;  // has reset_signal_is.
     bool                         m_has_stack;       // true is stack present.
@@ -437,6 +441,7 @@ class SC_API sc_process_b : public sc_object {
     sc_report*                   m_last_report_p;   // last report this process.
     sc_name_gen*                 m_name_gen_p;      // subprocess name generator
     sc_curr_proc_kind            m_process_kind;    // type of process.
+    sc_process_profile           m_profile;         // execution profile.
     int                          m_references_n;    // outstanding handles.
     std::vector<sc_reset*>       m_resets;          // resets for process.
     sc_event*                    m_reset_event_p;   // reset event.
@@ -456,7 +461,8 @@ class SC_API sc_process_b : public sc_object {
     bool                         m_unwinding;       // true if unwinding stack.
 
   protected:
-    static sc_process_b* m_last_created_process_p; // Last process created.
+    static SC_CONTEXT_LOCAL_ sc_process_b*
+                     m_last_created_process_p; // Last process created.
 };
 
 typedef sc_process_b sc_process_b;  // For compatibility.
@@ -490,7 +496,7 @@ sc_process_b::remove_child_object( sc_object* object_p )
 inline const ::std::vector<sc_object*>&
 sc_process_b::get_child_objects() const
 {
-    return m_child_objects;
+    return sc_object::get_child_objects();
 }
 
 
@@ -110,6 +110,7 @@ class SC_API sc_process_handle {
     inline const char* name() const;
     inline const char* basename() const;
     inline sc_curr_proc_kind proc_kind() const;
+    inline sc_process_profile profile() const;
     inline void reset(
         sc_descendant_inclusion_info descendants=SC_NO_DESCENDANTS );
     inline sc_event& reset_event() const;
@@ -381,6 +382,18 @@ inline sc_curr_proc_kind sc_process_handle::proc_kind() const
     return m_target_p ?  m_target_p->proc_kind() : SC_NO_PROC_;
 }
 
+// return the execution profile of this object instance's target.
+
+inline sc_process_profile sc_process_handle::profile() const
+{
+    if ( m_target_p )
+        return m_target_p->m_profile;
+    else {
+        SC_REPORT_WARNING( SC_ID_EMPTY_PROCESS_HANDLE_, "profile()");
+        return sc_process_profile();
+    }
+}
+
 // reset this object instance's target.
 
 inline void sc_process_handle::reset( sc_descendant_inclusion_info descendants )
@@ -0,0 +1,250 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_process_profile.cpp -- Collection and reporting of process profiles
+
+ *****************************************************************************/
+
+#if !defined(WIN32) && !defined(_WIN32)
+# include <time.h>
+#else
+# ifndef SC_INCLUDE_WINDOWS_H
+#   define SC_INCLUDE_WINDOWS_H // include Windows.h, if needed
+# endif
+#endif
+
+#include "sysc/kernel/sc_process_profiler.h"
+
+#if SC_CPLUSPLUS >= 201103L
+# include <chrono>
+#endif
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace sc_core {
+
+namespace {
+
+struct sc_profile_entry
+{
+    const char*               name;
+    sc_curr_proc_kind         kind;
+    const sc_process_profile* profile;
+};
+
+// descending host time, then ascending name
+bool sc_profile_entry_less( const sc_profile_entry& left,
+                            const sc_profile_entry& right )
+{
+    if( left.profile->host_time() != right.profile->host_time() )
+        return left.profile->host_time() > right.profile->host_time();
+    return std::string( left.name ) < std::string( right.name );
+}
+
+const char* sc_profile_kind( sc_curr_proc_kind kind )
+{
+    switch( kind )
+    {
+      case SC_METHOD_PROC_:  return "method";
+      case SC_THREAD_PROC_:  return "thread";
+      case SC_CTHREAD_PROC_: return "cthread";
+      default:               return "none";
+    }
+}
+
+// JSON string (RFC 8259): quotes, backslashes and control characters escaped
+void sc_profile_json_string( ::std::ostream& os, const char* s )
+{
+    os << '"';
+    for( ; *s; ++s )
+    {
+        unsigned char c = static_cast<unsigned char>( *s );
+        if( c < 0x20 ) { // control characters as \u00XX
+            static const char hex[] = "0123456789abcdef";
+            os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+            continue;
+        }
+        if( *s == '"' || *s == '\\' )
+            os << '\\';
+        os << *s;
+    }
+    os << '"';
+}
+
+// CSV field (RFC 4180): always quoted, embedded quotes are doubled
+void sc_profile_csv_string( ::std::ostream& os, const char* s )
+{
+    os << '"';
+    for( ; *s; ++s )
+    {
+        if( *s == '"' )
+            os << '"';
+        os << *s;
+    }
+    os << '"';
+}
+
+} // namespace
+
+sc_process_profiler::sc_process_profiler( sc_process_profile_format dump )
+  : m_dump( dump ), m_current_p( 0 ), m_since( host_now() ), m_retired()
+{}
+
+sc_dt::uint64
+sc_process_profiler::host_now()
+{
+#if SC_CPLUSPLUS >= 201103L
+    return static_cast<sc_dt::uint64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#elif !defined(WIN32) && !defined(_WIN32)
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return static_cast<sc_dt::uint64>( ts.tv_sec ) * 1000000000u
+         + static_cast<sc_dt::uint64>( ts.tv_nsec );
+#else
+    static LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter;
+    if( frequency.QuadPart == 0 )
+        QueryPerformanceFrequency( &frequency );
+    QueryPerformanceCounter( &counter );
+    return static_cast<sc_dt::uint64>(
+      counter.QuadPart * ( 1e9 / frequency.QuadPart ) );
+#endif
+}
+
+void
+sc_process_profiler::charge( sc_dt::uint64 now )
+{
+    if( m_current_p != 0 )
+        m_current_p->m_profile.m_host_ns += now - m_since;
+    m_since = now;
+}
+
+void
+sc_process_profiler::retire( sc_process_b* process_p )
+{
+    if( process_p == m_current_p )
+    {
+        charge( host_now() );
+        m_current_p = 0;
+    }
+
+    record r;
+    r.name    = process_p->name();
+    r.kind    = process_p->proc_kind();
+    r.profile = process_p->m_profile;
+    m_retired.push_back( r );
+}
+
+void
+sc_process_profiler::write( ::std::ostream& os,
+                            sc_process_profile_format format,
+                            const std::vector<sc_process_b*>& processes ) const
+{
+    std::vector<sc_profile_entry> entries;
+    entries.reserve( m_retired.size() + processes.size() );
+
+    for( std::size_t i = 0; i < m_retired.size(); ++i )
+    {
+        sc_profile_entry e =
+          { m_retired[i].name.c_str(), m_retired[i].kind,
+            &m_retired[i].profile };
+        entries.push_back( e );
+    }
+    for( std::size_t i = 0; i < processes.size(); ++i )
+    {
+        sc_profile_entry e =
+          { processes[i]->name(), processes[i]->proc_kind(),
+            &processes[i]->m_profile };
+        entries.push_back( e );
+    }
+    std::stable_sort( entries.begin(), entries.end(), sc_profile_entry_less );
+
+    ::std::ios_base::fmtflags flags = os.flags();
+    ::std::streamsize precision = os.precision();
+    os << ::std::fixed << ::std::setprecision( 6 );
+
+    switch( format )
+    {
+      case SC_PROFILE_TEXT:
+        os << "Process profile (" << entries.size() << " processes)\n"
+           << ::std::setw(14) << "host time [s]"
+           << ::std::setw(14) << "activations"
+           << ::std::setw(14) << "switches"
+           << ::std::setw(14) << "waits"
+           << "  kind     process\n";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            const sc_process_profile& p = *entries[i].profile;
+            os << ::std::setw(14) << p.host_time()
+               << ::std::setw(14) << p.activations()
+               << ::std::setw(14) << p.context_switches()
+               << ::std::setw(14) << p.waits()
+               << "  " << ::std::setw(7) << ::std::left
+               << sc_profile_kind( entries[i].kind ) << ::std::right
+               << "  " << entries[i].name << '\n';
+        }
+        break;
+
+      case SC_PROFILE_CSV:
+        os << "process,kind,host_time,activations,context_switches,waits\n";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            const sc_process_profile& p = *entries[i].profile;
+            sc_profile_csv_string( os, entries[i].name );
+            os << ',' << sc_profile_kind( entries[i].kind ) << ','
+               << p.host_time() << ','
+               << p.activations() << ','
+               << p.context_switches() << ','
+               << p.waits() << '\n';
+        }
+        break;
+
+      case SC_PROFILE_JSON:
+        os << "[";
+        for( std::size_t i = 0; i < entries.size(); ++i )
+        {
+            const sc_process_profile& p = *entries[i].profile;
+            os << ( i ? ",\n " : "\n " ) << "{ \"process\": ";
+            sc_profile_json_string( os, entries[i].name );
+            os << ", \"kind\": \"" << sc_profile_kind( entries[i].kind )
+               << "\", \"host_time\": " << p.host_time()
+               << ", \"activations\": " << p.activations()
+               << ", \"context_switches\": " << p.context_switches()
+               << ", \"waits\": " << p.waits() << " }";
+        }
+        os << "\n]\n";
+        break;
+
+      default:
+        break;
+    }
+
+    os.flags( flags );
+    os.precision( precision );
+}
+
+} // namespace sc_core
+
+// Taf!
@@ -0,0 +1,110 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_process_profile.h -- Execution profile of a process
+
+  The kernel collects a profile for each process while process profiling
+  is enabled via sc_set_process_profiling() or the environment variable
+  SC_PROCESS_PROFILE.  The profile of a process can be queried through
+  sc_process_handle::profile(), a report covering all processes is
+  written by sc_write_process_profile().
+
+ *****************************************************************************/
+
+#ifndef SC_PROCESS_PROFILE_H_INCLUDED_
+#define SC_PROCESS_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iosfwd>
+
+namespace sc_core {
+
+class sc_method_process;
+class sc_process_profiler;
+class sc_thread_process;
+
+enum sc_process_profile_format { // process profile report formats:
+    SC_PROFILE_NONE,             // no report
+    SC_PROFILE_TEXT,             // table sorted by host time
+    SC_PROFILE_CSV,              // comma-separated values
+    SC_PROFILE_JSON              // array of JSON objects
+};
+
+// process profiling, only allowed before the simulation starts:
+//     enable = true to collect the profiles of all processes,
+//     dump   = format of the report written to std::cout at sc_stop().
+extern SC_API void sc_set_process_profiling( bool enable,
+    sc_process_profile_format dump = SC_PROFILE_NONE );
+extern SC_API bool sc_get_process_profiling();
+
+// write the profiles of all processes, sorted by descending host time
+extern SC_API void sc_write_process_profile( ::std::ostream& os,
+    sc_process_profile_format format = SC_PROFILE_TEXT );
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_process_profile
+//
+//  Execution statistics of a single process.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_process_profile
+{
+    friend class sc_method_process;
+    friend class sc_process_profiler;
+    friend class sc_thread_process;
+
+public:
+
+    sc_process_profile()
+      : m_activations( 0 ), m_context_switches( 0 ), m_waits( 0 )
+      , m_host_ns( 0 )
+    {}
+
+    // number of times the process has been executed
+    sc_dt::uint64 activations() const      { return m_activations; }
+
+    // number of coroutine switches into the process (0 for SC_METHODs)
+    sc_dt::uint64 context_switches() const { return m_context_switches; }
+
+    // number of wait() or next_trigger() calls of the process
+    sc_dt::uint64 waits() const            { return m_waits; }
+
+    // cumulative host time spent in the process, in seconds
+    double host_time() const               { return m_host_ns * 1e-9; }
+
+private:
+
+    void count_wait()                      { ++m_waits; }
+
+private:
+    sc_dt::uint64 m_activations;      // # of activations.
+    sc_dt::uint64 m_context_switches; // # of coroutine switches.
+    sc_dt::uint64 m_waits;            // # of wait() / next_trigger() calls.
+    sc_dt::uint64 m_host_ns;          // host time in nanoseconds.
+};
+
+} // namespace sc_core
+
+#endif // SC_PROCESS_PROFILE_H_INCLUDED_
+
+// Taf!
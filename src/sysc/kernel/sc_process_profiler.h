@@ -0,0 +1,115 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_process_profiler.h -- Collection of per-process execution profiles
+
+  The simulation context owns a profiler while process profiling is
+  enabled and passes every change of the current process to it.  Host
+  time is charged to the process running between two such changes.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_PROCESS_PROFILER_H_INCLUDED_
+#define SC_PROCESS_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_process_profile.h"
+
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_process_profiler
+//
+//  Accumulates the sc_process_profile of each executed process.
+// ----------------------------------------------------------------------------
+
+class sc_process_profiler
+{
+public:
+
+    explicit sc_process_profiler( sc_process_profile_format dump );
+
+    sc_process_profile_format dump_format() const
+      { return m_dump; }
+
+    // the current process changes to process_p (0: the kernel itself)
+    inline void switch_to( sc_process_b* process_p );
+
+    // keep the profile of a process being destroyed
+    void retire( sc_process_b* process_p );
+
+    // write the profiles of the retired and the given existing processes
+    void write( ::std::ostream& os, sc_process_profile_format format,
+                const std::vector<sc_process_b*>& processes ) const;
+
+    static sc_dt::uint64 host_now(); // monotonic host time in nanoseconds
+
+private:
+
+    struct record
+    {
+        std::string        name;
+        sc_curr_proc_kind  kind;
+        sc_process_profile profile;
+    };
+
+    void charge( sc_dt::uint64 now );
+
+private:
+    sc_process_profile_format m_dump;      // report format at sc_stop().
+    sc_process_b*             m_current_p; // process charged for host time.
+    sc_dt::uint64             m_since;     // host time of the last switch.
+    std::vector<record>       m_retired;   // profiles of deleted processes.
+
+private:
+    // disabled
+    sc_process_profiler( const sc_process_profiler& );
+    sc_process_profiler& operator = ( const sc_process_profiler& );
+};
+
+inline void
+sc_process_profiler::switch_to( sc_process_b* process_p )
+{
+    if( process_p == m_current_p && process_p == 0 )
+        return;
+
+    charge( host_now() );
+
+    if( process_p != 0 )
+    {
+        sc_process_profile& profile = process_p->m_profile;
+        ++profile.m_activations;
+        if( process_p != m_current_p && process_p->m_is_thread )
+            ++profile.m_context_switches;
+    }
+    m_current_p = process_p;
+}
+
+} // namespace sc_core
+
+#endif // SC_PROCESS_PROFILER_H_INCLUDED_
+
+// Taf!
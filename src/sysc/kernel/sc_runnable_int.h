@@ -97,6 +97,34 @@ inline void sc_runnable::dump() const
     }
 }
 
+//------------------------------------------------------------------------------
+//"sc_runnable::method_pop_size" and "sc_runnable::thread_pop_size"
+//
+// These methods return the number of processes in the pop queues, i.e., the
+// number of processes about to be executed after a toggle.
+//------------------------------------------------------------------------------
+inline std::size_t sc_runnable::method_pop_size() const
+{
+    std::size_t size = 0;
+    for ( sc_method_handle p = m_methods_pop; p != SC_NO_METHODS;
+          p = p->next_runnable() )
+    {
+        ++size;
+    }
+    return size;
+}
+
+inline std::size_t sc_runnable::thread_pop_size() const
+{
+    std::size_t size = 0;
+    for ( sc_thread_handle p = m_threads_pop; p != SC_NO_THREADS;
+          p = p->next_runnable() )
+    {
+        ++size;
+    }
+    return size;
+}
+
 //------------------------------------------------------------------------------
 //"sc_runnable::execute_method_next"
 //
@@ -0,0 +1,156 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_scheduler_metrics.cpp -- Statistics of the simulation scheduler
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_scheduler_metrics.h"
+
+namespace sc_core {
+
+sc_scheduler_metrics::sc_scheduler_metrics( const sc_time& dump_period,
+                                            bool report_at_stop )
+  : m_histogram( 1, 0 )
+  , m_timesteps( 0 ), m_deltas( 0 ), m_timestep_deltas( 0 ), m_max_deltas( 0 )
+  , m_methods( 0 ), m_max_methods( 0 ), m_threads( 0 ), m_max_threads( 0 )
+  , m_updates( 0 ), m_max_updates( 0 )
+  , m_delta_notifications( 0 ), m_timed_notifications( 0 )
+  , m_queue_size( 0 ), m_max_queue_size( 0 )
+  , m_dump_period( dump_period ), m_next_dump( dump_period )
+  , m_report_at_stop( report_at_stop )
+{}
+
+void
+sc_scheduler_metrics::reset( const sc_time& dump_period, bool report_at_stop )
+{
+    m_histogram.assign( 1, 0 );
+    m_timesteps = m_deltas = m_timestep_deltas = m_max_deltas = 0;
+    m_methods = m_max_methods = m_threads = m_max_threads = 0;
+    m_updates = m_max_updates = 0;
+    m_delta_notifications = m_timed_notifications = 0;
+    m_queue_size = m_max_queue_size = 0;
+    m_dump_period = dump_period;
+    m_next_dump = dump_period;
+    m_report_at_stop = report_at_stop;
+}
+
+void
+sc_scheduler_metrics::report( const sc_time& now ) const
+{
+    ::std::cout << "Scheduler metrics at " << now << ":\n";
+    print( ::std::cout );
+}
+
+void
+sc_scheduler_metrics::delta( std::size_t methods, std::size_t threads,
+                             std::size_t updates, std::size_t notifications )
+{
+    ++m_deltas;
+    ++m_timestep_deltas;
+
+    m_methods += methods;
+    if( methods > m_max_methods )
+        m_max_methods = methods;
+    m_threads += threads;
+    if( threads > m_max_threads )
+        m_max_threads = threads;
+    m_updates += updates;
+    if( updates > m_max_updates )
+        m_max_updates = updates;
+    m_delta_notifications += notifications;
+}
+
+void
+sc_scheduler_metrics::timed( std::size_t notifications, std::size_t pending )
+{
+    m_timed_notifications += notifications;
+    m_queue_size = pending;
+    if( m_queue_size > m_max_queue_size )
+        m_max_queue_size = m_queue_size;
+}
+
+void
+sc_scheduler_metrics::timestep( const sc_time& now )
+{
+    // close the histogram entry of the previous timestep
+
+    std::size_t bucket = 0;
+    for( value_type n = m_timestep_deltas; n != 0; n >>= 1 )
+        ++bucket;
+    if( bucket >= m_histogram.size() )
+        m_histogram.resize( bucket + 1, 0 );
+    ++m_histogram[bucket];
+
+    ++m_timesteps;
+    if( m_timestep_deltas > m_max_deltas )
+        m_max_deltas = m_timestep_deltas;
+    m_timestep_deltas = 0;
+
+    // periodic dump
+
+    if( m_dump_period != SC_ZERO_TIME && now >= m_next_dump )
+    {
+        report( now );
+        m_next_dump = sc_time::from_value(
+          ( now.value() / m_dump_period.value() + 1 ) * m_dump_period.value() );
+    }
+}
+
+void
+sc_scheduler_metrics::print( ::std::ostream& os ) const
+{
+    value_type deltas = m_deltas ? m_deltas : 1;
+
+    os << "  timesteps                " << m_timesteps << "\n"
+       << "  delta cycles             " << m_deltas
+       << " (max. " << m_max_deltas << " per timestep)\n"
+       << "  runnable methods         " << m_methods
+       << " (avg. " << double( m_methods ) / deltas
+       << ", max. " << m_max_methods << " per delta)\n"
+       << "  runnable threads         " << m_threads
+       << " (avg. " << double( m_threads ) / deltas
+       << ", max. " << m_max_threads << " per delta)\n"
+       << "  channel updates          " << m_updates
+       << " (avg. " << double( m_updates ) / deltas
+       << ", max. " << m_max_updates << " per delta)\n"
+       << "  delta notifications      " << m_delta_notifications << "\n"
+       << "  timed notifications      " << m_timed_notifications << "\n"
+       << "  pending timed            " << m_queue_size
+       << " (max. " << m_max_queue_size << ")\n"
+       << "  deltas per timestep      ";
+    for( std::size_t i = 0; i < m_histogram.size(); ++i )
+    {
+        if( i != 0 )
+            os << ", ";
+        if( i < 2 )
+            os << i;
+        else
+            os << ( value_type(1) << ( i - 1 ) ) << "-"
+               << ( ( value_type(1) << i ) - 1 );
+        os << ": " << m_histogram[i];
+    }
+    os << ::std::endl;
+}
+
+} // namespace sc_core
+
+// Taf!
@@ -0,0 +1,162 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_scheduler_metrics.h -- Statistics of the simulation scheduler
+
+  While enabled via sc_set_scheduler_metrics() or the environment variable
+  SC_SCHEDULER_METRICS, the kernel records how many delta cycles are
+  executed per timestep, how many processes are runnable and how many
+  primitive channels are updated per delta cycle, as well as the number
+  of delta and timed notifications.
+
+ *****************************************************************************/
+
+#ifndef SC_SCHEDULER_METRICS_H_INCLUDED_
+#define SC_SCHEDULER_METRICS_H_INCLUDED_
+
+#include "sysc/kernel/sc_time.h"
+
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class sc_scheduler_metrics;
+
+// scheduler metrics:
+//     enable         = true to collect metrics, starting from zero,
+//                      false to stop collecting them.
+//     dump_period    = simulated time between reports written to std::cout,
+//                      SC_ZERO_TIME for no periodic reports.
+//     report_at_stop = true to write a final report at sc_stop().
+extern SC_API void sc_set_scheduler_metrics( bool enable,
+    const sc_time& dump_period = SC_ZERO_TIME, bool report_at_stop = true );
+
+// current scheduler metrics, 0 if not enabled; the object stays valid
+// until the simulation context is destroyed
+extern SC_API const sc_scheduler_metrics* sc_get_scheduler_metrics();
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_scheduler_metrics
+//
+//  Counters of the scheduler, updated once per delta cycle and timestep.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_scheduler_metrics
+{
+    friend class sc_simcontext;
+    friend SC_API void sc_set_scheduler_metrics( bool, const sc_time&, bool );
+
+public:
+
+    typedef sc_dt::uint64 value_type;
+
+    // histogram of the delta cycles per completed timestep: bucket 0
+    // counts timesteps without delta cycles, bucket k those with at
+    // least 2^(k-1) and less than 2^k delta cycles
+    const std::vector<value_type>& deltas_per_timestep() const
+      { return m_histogram; }
+
+    value_type timesteps() const               { return m_timesteps; }
+    value_type delta_cycles() const            { return m_deltas; }
+    value_type max_deltas_per_timestep() const { return m_max_deltas; }
+
+    // runnable processes and channel updates, summed up over all delta
+    // cycles and the maximum of a single delta cycle
+    value_type runnable_methods() const        { return m_methods; }
+    value_type max_runnable_methods() const    { return m_max_methods; }
+    value_type runnable_threads() const        { return m_threads; }
+    value_type max_runnable_threads() const    { return m_max_threads; }
+    value_type updates() const                 { return m_updates; }
+    value_type max_updates() const             { return m_max_updates; }
+
+    // triggered notifications
+    value_type delta_notifications() const     { return m_delta_notifications; }
+    value_type timed_notifications() const     { return m_timed_notifications; }
+
+    // pending timed notifications after the last timestep and the maximum
+    value_type timed_queue_size() const        { return m_queue_size; }
+    value_type max_timed_queue_size() const    { return m_max_queue_size; }
+
+    void print( ::std::ostream& os = ::std::cout ) const;
+
+private:
+
+    sc_scheduler_metrics( const sc_time& dump_period, bool report_at_stop );
+
+    // restart all counters from zero
+    void reset( const sc_time& dump_period, bool report_at_stop );
+
+    bool report_at_stop() const
+      { return m_report_at_stop; }
+    void report( const sc_time& now ) const; // write to std::cout
+
+    void delta( std::size_t methods, std::size_t threads,
+                std::size_t updates, std::size_t notifications );
+    void timed( std::size_t notifications, std::size_t pending );
+    void timestep( const sc_time& now );
+
+private:
+    std::vector<value_type> m_histogram;
+    value_type              m_timesteps;
+    value_type              m_deltas;
+    value_type              m_timestep_deltas; // of the current timestep.
+    value_type              m_max_deltas;
+    value_type              m_methods;
+    value_type              m_max_methods;
+    value_type              m_threads;
+    value_type              m_max_threads;
+    value_type              m_updates;
+    value_type              m_max_updates;
+    value_type              m_delta_notifications;
+    value_type              m_timed_notifications;
+    value_type              m_queue_size;
+    value_type              m_max_queue_size;
+    sc_time                 m_dump_period;    // zero: no periodic dump.
+    sc_time                 m_next_dump;      // time of the next dump.
+    bool                    m_report_at_stop; // report at sc_stop().
+
+private:
+    // disabled
+    sc_scheduler_metrics( const sc_scheduler_metrics& );
+    sc_scheduler_metrics& operator = ( const sc_scheduler_metrics& );
+};
+
+inline ::std::ostream&
+operator << ( ::std::ostream& os, const sc_scheduler_metrics& metrics )
+{
+    metrics.print( os );
+    return os;
+}
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+#endif // SC_SCHEDULER_METRICS_H_INCLUDED_
+
+// Taf!
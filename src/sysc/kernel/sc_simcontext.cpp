@@ -36,15 +36,23 @@
 #include "sysc/kernel/sc_cor_qt.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_kernel_task.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_offload_pool.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_elab_profiler.h"
+#include "sysc/kernel/sc_process_profiler.h"
+#include "sysc/kernel/sc_stack_profiler.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_reset.h"
+#include "sysc/kernel/sc_scheduler_metrics.h"
+#include "sysc/kernel/sc_timed_queue.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/kernel/sc_dynamic_processes.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
@@ -58,9 +66,15 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <sstream>
 
+#if !defined(_WIN32) && !defined(WIN32) && !defined(WIN64)
+#  include <unistd.h> // fork
+#endif
+
 // DEBUGGING MACROS:
 //
 // DEBUG_MSG(NAME,P,MSG)
@@ -101,7 +115,7 @@
 
 namespace sc_core {
 
-sc_stop_mode stop_mode = SC_STOP_FINISH_DELTA;
+SC_CONTEXT_LOCAL_ sc_stop_mode stop_mode = SC_STOP_FINISH_DELTA;
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_process_table
@@ -334,14 +348,117 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    const char* parallel = std::getenv("SC_PARALLEL_EVALUATION");
+    sc_string_view parallel_s = (parallel != NULL) ? parallel : "";
+    if ( parallel_s == "AUTO" )
+        m_parallel_threads = sc_host_thread::hardware_concurrency();
+    else if ( parallel != NULL )
+        m_parallel_threads =
+          static_cast<unsigned>( std::strtoul( parallel, NULL, 10 ) );
+    else
+        m_parallel_threads = 0;
+
+    const char* offload = std::getenv("SC_OFFLOAD_THREADS");
+    sc_string_view offload_s = (offload != NULL) ? offload : "";
+    if ( offload != NULL && offload_s != "AUTO" )
+        m_offload_threads =
+          static_cast<unsigned>( std::strtoul( offload, NULL, 10 ) );
+    else
+        m_offload_threads = sc_host_thread::hardware_concurrency();
+
+    const char* timed_queue = std::getenv("SC_TIMED_QUEUE");
+    sc_string_view timed_queue_s = (timed_queue != NULL) ? timed_queue : "";
+    if ( timed_queue_s == "WHEEL" )
+        m_timed_queue_policy = SC_TIMED_QUEUE_WHEEL;
+    else
+        m_timed_queue_policy = SC_TIMED_QUEUE_HEAP;
+
+    const char* profile = std::getenv("SC_PROCESS_PROFILE");
+    sc_string_view profile_s = (profile != NULL) ? profile : "";
+    if ( profile_s == "TEXT" )
+        m_process_profiler = new sc_process_profiler( SC_PROFILE_TEXT );
+    else if ( profile_s == "CSV" )
+        m_process_profiler = new sc_process_profiler( SC_PROFILE_CSV );
+    else if ( profile_s == "JSON" )
+        m_process_profiler = new sc_process_profiler( SC_PROFILE_JSON );
+    else if ( profile_s == "ON" )
+        m_process_profiler = new sc_process_profiler( SC_PROFILE_NONE );
+    else
+        m_process_profiler = 0;
+
+    const char* elab_profile = std::getenv("SC_ELAB_PROFILE");
+    sc_string_view elab_profile_s =
+      (elab_profile != NULL) ? elab_profile : "";
+    if ( elab_profile_s == "TEXT" )
+        m_elab_profiler = new sc_elab_profiler( SC_PROFILE_TEXT );
+    else if ( elab_profile_s == "CSV" )
+        m_elab_profiler = new sc_elab_profiler( SC_PROFILE_CSV );
+    else if ( elab_profile_s == "JSON" )
+        m_elab_profiler = new sc_elab_profiler( SC_PROFILE_JSON );
+    else if ( elab_profile_s == "ON" )
+        m_elab_profiler = new sc_elab_profiler( SC_PROFILE_NONE );
+    else
+        m_elab_profiler = 0;
+
+    const char* metrics = std::getenv("SC_SCHEDULER_METRICS");
+    sc_string_view metrics_s = (metrics != NULL) ? metrics : "";
+    m_scheduler_metrics_storage = 0;
+    if ( metrics_s == "ON" )
+        m_scheduler_metrics = m_scheduler_metrics_storage =
+          new sc_scheduler_metrics( SC_ZERO_TIME, true );
+    else
+        m_scheduler_metrics = 0;
+
+    const char* stack_profile = std::getenv("SC_STACK_PROFILE");
+    sc_string_view stack_profile_s =
+      (stack_profile != NULL) ? stack_profile : "";
+    if ( stack_profile_s == "REPORT" )
+        m_stack_profiler = new sc_stack_profiler( "" );
+    else if ( !stack_profile_s.empty() )
+        m_stack_profiler = new sc_stack_profiler( stack_profile );
+    else
+        m_stack_profiler = 0;
+
+    const char* stack_arena = std::getenv("SC_STACK_ARENA");
+    sc_string_view stack_arena_s = (stack_arena != NULL) ? stack_arena : "";
+    if ( stack_arena_s == "GUARD" )
+        m_stack_arena = sc_cor_pkg::STACK_ARENA_GUARD_PAGES;
+    else if ( stack_arena_s == "NOGUARD" )
+        m_stack_arena = 0;
+    else if ( stack_arena_s == "HUGE" )
+        m_stack_arena = sc_cor_pkg::STACK_ARENA_HUGE_PAGES;
+    else
+        m_stack_arena = -1;
+
+    const char* lazy_clocks = std::getenv("SC_LAZY_CLOCKS");
+    sc_string_view lazy_clocks_s = (lazy_clocks != NULL) ? lazy_clocks : "";
+    m_lazy_clocks = ( lazy_clocks_s == "ON" );
+
+    const char* fast_teardown = std::getenv("SC_FAST_TEARDOWN");
+    sc_string_view fast_teardown_s =
+      (fast_teardown != NULL) ? fast_teardown : "";
+    m_fast_teardown = ( fast_teardown_s == "ON" );
+
+    const char* direct_ports = std::getenv("SC_DIRECT_PORTS");
+    sc_string_view direct_ports_s =
+      (direct_ports != NULL) ? direct_ports : "";
+    m_direct_ports = ( direct_ports_s == "ON" );
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    if ( m_timed_queue_policy == SC_TIMED_QUEUE_WHEEL )
+        m_timed_events = new sc_timed_wheel;
+    else
+        m_timed_events = new sc_timed_heap;
+    m_timed_events_cancelled = 0;
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
     m_collectable = new sc_process_list;
+    m_parallel_evaluator = 0;
+    m_parallel_phase = false;
+    m_offload_pool = 0;
     m_time_params = new sc_time_params;
     m_curr_time = SC_ZERO_TIME;
     m_max_time = SC_ZERO_TIME;
@@ -367,15 +484,41 @@ sc_simcontext::init()
 void
 sc_simcontext::clean()
 {
-    // remove remaining zombie processes
-    do_collect_processes();
+    // wait for offloaded jobs, which refer to the stacks of their callers
+    delete m_offload_pool;
+    m_offload_pool = 0;
+
+    // remove remaining zombie processes, unless left to the exit of the
+    // host process by a fast teardown
+    if ( !in_fast_teardown() )
+        do_collect_processes();
 
+    delete m_parallel_evaluator;
+    delete m_process_profiler;
+    m_process_profiler = 0;
+    delete m_elab_profiler;
+    m_elab_profiler = 0;
+    delete m_scheduler_metrics_storage;
+    m_scheduler_metrics_storage = 0;
+    m_scheduler_metrics = 0;
+    write_stack_profile();
+    delete m_stack_profiler;
+    m_stack_profiler = 0;
     delete m_method_invoker_p;
     delete m_error;
     delete m_cor_pkg;
     delete m_time_params;
     delete m_collectable;
     delete m_runnable;
+
+    // detach pending timed notifications from their events
+    while( m_timed_events->size() ) {
+        sc_event_timed* et = m_timed_events->extract_top();
+        if( et->event() != 0 ) {
+            et->event()->m_notify_type = sc_event::NONE;
+        }
+        delete et;
+    }
     delete m_timed_events;
     delete m_process_table;
     delete m_name_gen;
@@ -405,7 +548,16 @@ sc_simcontext::sc_simcontext() :
     m_process_table(0), m_curr_proc_info(), m_current_writer(0),
     m_write_check(SC_SIGNAL_WRITE_CHECK_DEFAULT_), m_next_proc_id(-1),
     m_child_events(), m_child_objects(), m_delta_events(), m_timed_events(0),
+    m_timed_queue_policy(SC_TIMED_QUEUE_HEAP), m_timed_events_now(),
+    m_timed_events_cancelled(0),
     m_trace_files(), m_something_to_trace(false), m_runnable(0), m_collectable(0),
+    m_parallel_threads(0), m_parallel_evaluator(0), m_parallel_phase(false),
+    m_offload_threads(0), m_offload_pool(0),
+    m_process_profiler(0), m_elab_profiler(0), m_scheduler_metrics(0),
+    m_scheduler_metrics_storage(0),
+    m_stack_profiler(0),
+    m_stack_arena(-1), m_lazy_clocks(false), m_fast_teardown(false),
+    m_direct_ports(false),
     m_time_params(), m_curr_time(SC_ZERO_TIME), m_max_time(SC_ZERO_TIME),
     m_change_stamp(0), m_delta_count(0), m_initial_delta_count_at_current_time(0),
     m_forced_stop(false), m_paused(false),
@@ -442,6 +594,141 @@ sc_simcontext::active_object()
     return result_p;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::crunch_parallel"
+// |
+// | This method executes the given parallel-safe method process together with
+// | all parallel-safe method processes directly following it in the queue of
+// | runnable methods on the host threads of the parallel evaluator. Updates
+// | requested by these processes are committed in queue order afterwards.
+// |
+// | Arguments:
+// |     method_h = parallel-safe method process popped from the run queue.
+// | Result is false if an unfielded exception occurred, true if not.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::crunch_parallel( sc_method_handle method_h )
+{
+    std::vector<sc_method_handle>& batch = m_parallel_evaluator->batch();
+
+    batch.push_back( method_h );
+    while( (method_h = m_runnable->pop_method()) != 0 )
+    {
+        if ( !method_h->run_parallel() )
+        {
+            m_runnable->push_front_method( method_h );
+            break;
+        }
+        batch.push_back( method_h );
+    }
+
+    // nothing to parallelize, run the single process directly
+
+    if ( batch.size() == 1 )
+    {
+        method_h = batch.front();
+        batch.clear();
+        return method_h->run_process();
+    }
+
+    reset_curr_proc(); // each host thread has its own current process
+    m_parallel_phase = true;
+    m_prim_channel_registry->m_defer_updates = true;
+    m_parallel_evaluator->run();
+    m_prim_channel_registry->m_defer_updates = false;
+    m_parallel_phase = false;
+
+    sc_report* error_p = m_parallel_evaluator->commit();
+    if ( error_p )
+    {
+        set_error( error_p );
+        return false;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::fork_simulation"
+// |
+// | This method forks the host process for sc_fork_simulation(), after
+// | flushing all output, and redirects the trace files of the child.
+// |
+// | Arguments:
+// |     trace_suffix = suffix of the child's trace files, 0 for the default.
+// | Result is the result of fork().
+// +----------------------------------------------------------------------------
+int
+sc_simcontext::fork_simulation( const char* trace_suffix )
+{
+#if defined(_WIN32) || defined(WIN32) || defined(WIN64)
+    (void)trace_suffix;
+    return -1;
+#else
+    // flush all output buffers, which would be written twice otherwise
+
+    for ( std::size_t i = 0; i < m_trace_files.size(); ++i )
+        m_trace_files[i]->before_fork();
+    ::std::cout.flush();
+    ::std::cerr.flush();
+    std::fflush( NULL );
+
+    // host threads do not survive the fork, restart them on both sides
+
+    bool parallel = ( m_parallel_evaluator != 0 );
+    delete m_parallel_evaluator;
+    m_parallel_evaluator = 0;
+    delete m_offload_pool; // restarted upon the next sc_offload()
+    m_offload_pool = 0;
+
+    pid_t pid = fork();
+
+    if ( parallel )
+        m_parallel_evaluator = new sc_parallel_evaluator( m_parallel_threads );
+
+    if ( pid == 0 )
+    {
+        std::string suffix;
+        if ( trace_suffix ) {
+            suffix = trace_suffix;
+        } else {
+            std::stringstream ss;
+            ss << "_" << getpid();
+            ss.str().swap( suffix );
+        }
+        for ( std::size_t i = 0; i < m_trace_files.size(); ++i )
+            m_trace_files[i]->after_fork( suffix );
+    }
+    return static_cast<int>( pid );
+#endif
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::parallel_curr_proc_info"
+// |
+// | This method returns the process information of the calling host thread
+// | while method processes are executed in parallel.
+// +----------------------------------------------------------------------------
+sc_curr_proc_handle
+sc_simcontext::parallel_curr_proc_info() const
+{
+    sc_curr_proc_handle info_p = sc_parallel_evaluator::curr_proc_info();
+    return info_p ? info_p : &m_curr_proc_info;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::get_offload_pool"
+// |
+// | This method returns the pool of host threads for sc_offload(), which is
+// | started upon first use.
+// +----------------------------------------------------------------------------
+sc_offload_pool*
+sc_simcontext::get_offload_pool()
+{
+    if ( !m_offload_pool )
+        m_offload_pool = new sc_offload_pool( m_offload_threads );
+    return m_offload_pool;
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_simcontext::crunch"
 // |
@@ -474,16 +761,27 @@ sc_simcontext::crunch( bool once )
 
 	m_execution_phase = phase_evaluate;
 	bool empty_eval_phase = true;
+	std::size_t methods_n = 0; // runnable processes for scheduler metrics
+	std::size_t threads_n = 0;
 	while( true )
 	{
 
 	    // execute method processes
 
 	    m_runnable->toggle_methods();
+	    if( SC_UNLIKELY_( m_scheduler_metrics != 0 ) )
+		methods_n += m_runnable->method_pop_size();
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != 0 ) {
 		empty_eval_phase = false;
-		if ( !method_h->run_process() )
+		if ( m_parallel_evaluator && method_h->run_parallel() )
+		{
+		    if ( !crunch_parallel( method_h ) )
+		    {
+			goto out;
+		    }
+		}
+		else if ( !method_h->run_process() )
 		{
 		    goto out;
 		}
@@ -493,6 +791,8 @@ sc_simcontext::crunch( bool once )
 	    // execute (c)thread processes
 
 	    m_runnable->toggle_threads();
+	    if( SC_UNLIKELY_( m_scheduler_metrics != 0 ) )
+		threads_n += m_runnable->thread_pop_size();
 	    sc_thread_handle thread_h = pop_runnable_thread();
 	    while( thread_h != 0 ) {
                 if ( thread_h->m_cor_p != NULL ) break;
@@ -519,6 +819,13 @@ sc_simcontext::crunch( bool once )
 	    }
 	}
 
+        // wait for the computations offloaded by the (c)thread processes,
+        // which resume in the next delta cycle:
+
+        if( m_offload_pool && m_offload_pool->outstanding() ) {
+            m_offload_pool->complete();
+        }
+
         // remove finally dead zombies:
         do_collect_processes();
 
@@ -534,7 +841,7 @@ sc_simcontext::crunch( bool once )
 //	    SC_DO_PHASE_CALLBACK_(evaluation_done);
 	    m_change_stamp++;
 	}
-	m_prim_channel_registry->perform_update();
+	std::size_t updates_n = m_prim_channel_registry->perform_update();
 	SC_DO_PHASE_CALLBACK_(update_done);
 	m_execution_phase = phase_notify;
 
@@ -578,6 +885,9 @@ sc_simcontext::crunch( bool once )
 	    m_delta_events.clear();
 	}
 
+	if( SC_UNLIKELY_( m_scheduler_metrics != 0 ) )
+	    m_scheduler_metrics->delta( methods_n, threads_n, updates_n, size );
+
 	if ( !empty_eval_phase )
 		m_delta_count ++;
 
@@ -600,6 +910,13 @@ sc_simcontext::crunch( bool once )
     // by '*m_error'.
 out:
     this->reset_curr_proc();
+
+    // jobs offloaded before an error or an immediate stop must not be lost,
+    // their threads resume once the simulation continues:
+    if( m_offload_pool && m_offload_pool->outstanding() ) {
+        m_offload_pool->complete();
+    }
+
     do_collect_processes();
     if( m_error ) throw *m_error; // re-throw propagated error
 }
@@ -633,6 +950,9 @@ sc_simcontext::elaborate()
     m_method_invoker_p =
       new sc_invoke_method("$$$$kernel_module$$$$_invoke_method" );
 
+    if( m_elab_profiler )
+        m_elab_profiler->enter( sc_elab_profiler::before_end_of_elaboration );
+
     m_simulation_status = SC_BEFORE_END_OF_ELABORATION;
     for( int cd = 0; cd != 4; /* empty */ )
     {
@@ -659,6 +979,14 @@ sc_simcontext::elaborate()
     m_elaboration_done = true;
     m_simulation_status = SC_END_OF_ELABORATION;
 
+    // COMPLETE THE BINDING OF ALL PORTS:
+
+    if( m_elab_profiler )
+        m_elab_profiler->enter( sc_elab_profiler::binding );
+    m_port_registry->complete_binding();
+
+    if( m_elab_profiler )
+        m_elab_profiler->enter( sc_elab_profiler::end_of_elaboration );
     m_port_registry->elaboration_done();
     m_export_registry->elaboration_done();
     m_prim_channel_registry->elaboration_done();
@@ -690,6 +1018,8 @@ sc_simcontext::prepare_to_simulate()
     // NOTIFY ALL OBJECTS THAT SIMULATION IS ABOUT TO START:
 
     m_simulation_status = SC_START_OF_SIMULATION;
+    if( m_elab_profiler )
+        m_elab_profiler->enter( sc_elab_profiler::start_of_simulation );
     m_port_registry->start_simulation();
     m_export_registry->start_simulation();
     m_prim_channel_registry->start_simulation();
@@ -697,6 +1027,14 @@ sc_simcontext::prepare_to_simulate()
     SC_DO_PHASE_CALLBACK_(start_simulation);
     m_start_of_simulation_called = true;
 
+    if( m_elab_profiler )
+    {
+        m_elab_profiler->enter( sc_elab_profiler::phases );
+        if( m_elab_profiler->dump_format() != SC_PROFILE_NONE )
+            m_elab_profiler->write( ::std::cout,
+                                    m_elab_profiler->dump_format() );
+    }
+
     // CHECK FOR CALL(S) TO sc_stop
 
     if( m_forced_stop ) {
@@ -705,6 +1043,25 @@ sc_simcontext::prepare_to_simulate()
     }
 
     // PREPARE ALL (C)THREAD PROCESSES FOR SIMULATION:
+    //
+    // If enabled, the stacks of all threads known at this point are carved
+    // out of a single reservation, see SC_STACK_ARENA.
+
+    if ( m_stack_arena >= 0 )
+    {
+        std::size_t size = 0;
+        std::size_t count = 0;
+        for ( thread_p = m_process_table->thread_q_head();
+              thread_p; thread_p = thread_p->next_exist() )
+        {
+            if ( m_stack_profiler )
+                thread_p->m_stack_size = m_stack_profiler->stack_size(
+                  thread_p->name(), thread_p->m_stack_size );
+            size += thread_p->m_stack_size;
+            ++count;
+        }
+        m_cor_pkg->reserve_stacks( size, count, m_stack_arena );
+    }
 
     for ( thread_p = m_process_table->thread_q_head();
 	  thread_p; thread_p = thread_p->next_exist() )
@@ -712,6 +1069,22 @@ sc_simcontext::prepare_to_simulate()
 	thread_p->prepare_for_simulation();
     }
 
+    // START HOST THREADS FOR THE PARALLEL EVALUATION OF METHOD PROCESSES:
+    //
+    // Process profiling charges host time to the current process of the
+    // kernel, so profiled simulations execute all methods sequentially.
+
+    if ( m_parallel_threads > 1 && !m_process_profiler )
+    {
+        m_parallel_evaluator = new sc_parallel_evaluator( m_parallel_threads );
+        if ( m_parallel_evaluator->threads() < 2 )
+        {
+            SC_REPORT_WARNING( SC_ID_PARALLEL_EVALUATION_UNAVAILABLE_, 0 );
+            delete m_parallel_evaluator;
+            m_parallel_evaluator = 0;
+        }
+    }
+
     m_simulation_status = SC_RUNNING;
     m_ready_to_simulate = true;
     m_runnable->init();
@@ -915,17 +1288,24 @@ sc_simcontext::simulate( const sc_time& duration )
 
 	    // PROCESS TIMED NOTIFICATIONS AT THE CURRENT TIME
 
-	    do {
-		sc_event_timed* et = m_timed_events->extract_top();
+	    m_timed_events->extract_all( m_timed_events_now );
+	    if( SC_UNLIKELY_( m_scheduler_metrics != 0 ) )
+		m_scheduler_metrics->timed( m_timed_events_now.size(),
+		                            m_timed_events->size() );
+	    for( std::size_t i = 0; i < m_timed_events_now.size(); ++i ) {
+		sc_event_timed* et = m_timed_events_now[i];
 		sc_event* e = et->event();
 		delete et;
 		if( e != 0 ) {
 		    e->trigger();
 		}
-	    } while( m_timed_events->size() &&
-		     m_timed_events->top()->notify_time() == t );
+	    }
+	    m_timed_events_now.clear();
 
-	} while( m_runnable->is_empty() );
+	    // posted kernel tasks are executed in the update phase
+
+	} while( m_runnable->is_empty()
+	         && !m_prim_channel_registry->pending_tasks() );
     } while ( t < until_t ); // hold off on the delta for the until_t time.
 
 exit_time:  // final simulation time update, if needed
@@ -944,6 +1324,10 @@ sc_simcontext::do_timestep(const sc_time& t)
 
     SC_DO_PHASE_CALLBACK_(before_timestep);
 
+    if( m_scheduler_metrics ) {
+        m_scheduler_metrics->timestep( t );
+    }
+
 #if SC_SIMCONTEXT_TRACING_
     if( m_something_to_trace ) {
         trace_cycle( false );
@@ -1038,6 +1422,54 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_PHASE_CALLBACK_(simulation_done);
     m_end_of_simulation_called = true;
+
+    if ( m_process_profiler &&
+         m_process_profiler->dump_format() != SC_PROFILE_NONE )
+        sc_write_process_profile( ::std::cout,
+                                  m_process_profiler->dump_format() );
+    if ( m_scheduler_metrics && m_scheduler_metrics->report_at_stop() )
+        m_scheduler_metrics->report( m_curr_time );
+    write_stack_profile();
+
+    // the objects may never be destroyed in a fast teardown, close the
+    // trace files and the report log and flush all other output now
+    if ( m_fast_teardown )
+    {
+        for ( std::size_t i = 0; i < m_trace_files.size(); ++i )
+            m_trace_files[i]->before_teardown();
+        m_trace_files.clear();
+        m_something_to_trace = false;
+        sc_report_close_default_log();
+
+        ::std::cout.flush();
+        ::std::cerr.flush();
+        std::fflush( NULL );
+
+        // objects destroyed from now on skip their removal from the child
+        // lists (see sc_object::detach), so drop the lists right away
+        for ( sc_object* obj_p = first_object(); obj_p; obj_p = next_object() )
+        {
+            if ( obj_p->m_children_p )
+                obj_p->m_children_p->objects.clear();
+        }
+        m_child_objects.clear();
+    }
+}
+
+void
+sc_simcontext::write_stack_profile()
+{
+    if ( !m_stack_profiler || m_stack_profiler->written() )
+        return;
+
+    std::vector<sc_thread_process*> threads;
+    for ( sc_object* obj_p = first_object(); obj_p; obj_p = next_object() )
+    {
+        sc_thread_process* thread_p = dynamic_cast<sc_thread_process*>( obj_p );
+        if ( thread_p )
+            threads.push_back( thread_p );
+    }
+    m_stack_profiler->write( threads );
 }
 
 void
@@ -1243,7 +1675,8 @@ void
 sc_simcontext::remove_trace_file( sc_trace_file* tf )
 {
     m_trace_files.erase(
-        std::remove( m_trace_files.begin(), m_trace_files.end(), tf )
+        std::remove( m_trace_files.begin(), m_trace_files.end(), tf ),
+        m_trace_files.end()
     );
     m_something_to_trace = ( m_trace_files.size() > 0 );
 }
@@ -1377,11 +1810,82 @@ sc_simcontext::next_time( sc_time& result ) const
 	    result = et->notify_time();
 	    return true;
 	}
-	delete m_timed_events->extract_top();
+	delete m_timed_events->extract_top(); // dead entry
     }
     return false;
 }
 
+void
+sc_simcontext::add_timed_event( sc_event_timed* et )
+{
+    m_timed_events->insert( et );
+}
+
+//------------------------------------------------------------------------------
+//"sc_simcontext::remove_timed_event"
+//
+// This method cancels a pending timed notification.  Entries of the batch
+// currently being triggered by simulate() have already left the queue, e.g.,
+// the timeout of a process woken by another event of the same time step.
+// Such an entry is only detached from its event; simulate() deletes it.
+//------------------------------------------------------------------------------
+void
+sc_simcontext::remove_timed_event( sc_event_timed* et )
+{
+    m_timed_events_cancelled++;
+    if( et->m_queue_index < 0 ) {
+        if( et->m_event != 0 ) {
+            et->m_event->m_timed = 0;
+            et->m_event = 0;
+        }
+        return;
+    }
+    m_timed_events->remove( et );
+    delete et;
+}
+
+int
+sc_simcontext::pending_timed_events() const
+{
+    return m_timed_events->size();
+}
+
+sc_dt::uint64
+sc_simcontext::cancelled_timed_events() const
+{
+    return m_timed_events_cancelled;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::set_timed_queue_policy"
+// |
+// | This method replaces the queue of pending timed notifications by one
+// | implementing the given policy. Pending notifications are moved over.
+// |
+// | Arguments:
+// |     policy = implementation of the new queue.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::set_timed_queue_policy( sc_timed_queue_policy policy )
+{
+    if( policy == m_timed_queue_policy ) {
+        return;
+    }
+
+    sc_timed_queue* queue_p;
+    if( policy == SC_TIMED_QUEUE_WHEEL ) {
+        queue_p = new sc_timed_wheel;
+    } else {
+        queue_p = new sc_timed_heap;
+    }
+    while( m_timed_events->size() ) {
+        queue_p->insert( m_timed_events->extract_top() );
+    }
+    delete m_timed_events;
+    m_timed_events = queue_p;
+    m_timed_queue_policy = policy;
+}
+
 void
 sc_simcontext::remove_delta_event( sc_event* e )
 {
@@ -1537,8 +2041,8 @@ sc_simcontext::trace_cycle( bool delta_cycle )
 	static sc_simcontext sc_default_global_context;
 	sc_simcontext* sc_curr_simcontext = &sc_default_global_context;
 #else
-	SC_API sc_simcontext* sc_curr_simcontext = 0;
-	SC_API sc_simcontext* sc_default_global_context = 0;
+	SC_API SC_CONTEXT_LOCAL_ sc_simcontext* sc_curr_simcontext = 0;
+	SC_API SC_CONTEXT_LOCAL_ sc_simcontext* sc_default_global_context = 0;
 #endif
 #else
 // Not MT-safe!
@@ -1561,6 +2065,21 @@ sc_get_curr_simcontext()
 }
 #endif // 0
 
+//------------------------------------------------------------------------------
+//"sc_set_curr_simcontext"
+//
+// This function selects the simulation context used by the calling host
+// thread.  Passing 0 selects the default context, which is created on demand
+// by sc_get_curr_simcontext().
+//------------------------------------------------------------------------------
+SC_API sc_simcontext*
+sc_set_curr_simcontext( sc_simcontext* context )
+{
+    sc_simcontext* previous = sc_curr_simcontext;
+    sc_curr_simcontext = context ? context : sc_default_global_context;
+    return previous;
+}
+
 // Generates unique names within each module.
 
 SC_API const char*
@@ -1870,6 +2389,444 @@ sc_get_stop_mode()
     return stop_mode;
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_parallel_evaluation"
+//
+// This function sets the number of host threads used to execute parallel-safe
+// method processes during the evaluation phase. The default is taken from the
+// environment variable SC_PARALLEL_EVALUATION (a number or "AUTO").
+//     threads = number of host threads, 0 or 1 disables parallel evaluation.
+//------------------------------------------------------------------------------
+SC_API void sc_set_parallel_evaluation( unsigned threads )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_PARALLEL_EVALUATION_AFTER_START_,"");
+        return;
+    }
+    simc_p->m_parallel_threads = threads;
+}
+
+SC_API unsigned
+sc_get_parallel_evaluation()
+{
+    return sc_get_curr_simcontext()->m_parallel_threads;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_offload_threads"
+//
+// This function sets the number of host threads executing computations
+// offloaded via sc_offload(). The default is taken from the environment
+// variable SC_OFFLOAD_THREADS (a number or "AUTO", the default).
+//     threads = number of host threads, 0 executes the computations on the
+//               simulator's thread.
+//------------------------------------------------------------------------------
+SC_API void sc_set_offload_threads( unsigned threads )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_OFFLOAD_THREADS_AFTER_START_,"");
+        return;
+    }
+    simc_p->m_offload_threads = threads;
+}
+
+SC_API unsigned
+sc_get_offload_threads()
+{
+    return sc_get_curr_simcontext()->m_offload_threads;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_timed_queue_policy"
+//
+// This function selects the implementation of the queue of pending timed
+// notifications. The default is taken from the environment variable
+// SC_TIMED_QUEUE ("HEAP" or "WHEEL").
+//     policy = SC_TIMED_QUEUE_HEAP or SC_TIMED_QUEUE_WHEEL.
+//------------------------------------------------------------------------------
+SC_API void sc_set_timed_queue_policy( sc_timed_queue_policy policy )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_TIMED_QUEUE_AFTER_START_,"");
+        return;
+    }
+
+    switch( policy )
+    {
+      case SC_TIMED_QUEUE_HEAP:
+      case SC_TIMED_QUEUE_WHEEL:
+          simc_p->set_timed_queue_policy( policy );
+          break;
+      default:
+          break;
+    }
+}
+
+SC_API sc_timed_queue_policy
+sc_get_timed_queue_policy()
+{
+    return sc_get_curr_simcontext()->m_timed_queue_policy;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_fast_teardown"
+//
+// This function enables the fast teardown of the simulation. Once the end
+// of simulation has been reached (i.e., after sc_stop()), all output is
+// flushed and destroyed objects skip their removal from their parents and
+// from the registries of the kernel, which costs a linear search each.
+// Zombie processes are left to the exit of the host process. The object
+// hierarchy shall not be inspected, once objects have been destroyed. The
+// default is taken from the environment variable SC_FAST_TEARDOWN ("ON").
+//     enable = true to enable the fast teardown.
+//------------------------------------------------------------------------------
+SC_API void sc_set_fast_teardown( bool enable )
+{
+    sc_get_curr_simcontext()->m_fast_teardown = enable;
+}
+
+SC_API bool
+sc_get_fast_teardown()
+{
+    return sc_get_curr_simcontext()->m_fast_teardown;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_direct_port_access"
+//
+// This function enables the direct access of signal ports to their
+// channels. At the end of elaboration, each sc_in, sc_inout and sc_out
+// port bound to a plain sc_signal or sc_buffer keeps pointers to the
+// current value and to the non-virtual write method of the channel, so
+// that reads and writes bypass the interface. Other channels, including
+// classes derived from sc_signal, are accessed via their interface
+// methods. The default is taken from the environment variable
+// SC_DIRECT_PORTS ("ON").
+//     enable = true to enable the direct port access.
+//------------------------------------------------------------------------------
+SC_API void sc_set_direct_port_access( bool enable )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_elaboration_done )
+    {
+        SC_REPORT_WARNING(SC_ID_DIRECT_PORT_ACCESS_AFTER_START_,"");
+        return;
+    }
+    simc_p->m_direct_ports = enable;
+}
+
+SC_API bool
+sc_get_direct_port_access()
+{
+    return sc_get_curr_simcontext()->m_direct_ports;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_profiling"
+//
+// This function enables the measurement of the stack high-water marks of
+// thread processes (QuickThreads only). The default is taken from the
+// environment variable SC_STACK_PROFILE ("REPORT" or a file name).
+//     enable = true to measure the high-water marks.
+//     file   = profile file assigning stack sizes to thread processes by
+//              name, which is read now and rewritten at the end of the
+//              simulation, or 0 to write the high-water marks to std::cout.
+//------------------------------------------------------------------------------
+SC_API void sc_set_stack_profiling( bool enable, const char* file )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_STACK_PROFILING_AFTER_START_,"");
+        return;
+    }
+    delete simc_p->m_stack_profiler;
+    simc_p->m_stack_profiler =
+      enable ? new sc_stack_profiler( file ? file : "" ) : 0;
+}
+
+SC_API bool
+sc_get_stack_profiling()
+{
+    return sc_get_curr_simcontext()->m_stack_profiler != 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_arena"
+//
+// This function selects whether the stacks of the thread processes known at
+// the end of elaboration are carved out of a single reservation
+// (QuickThreads only). The default is taken from the environment variable
+// SC_STACK_ARENA ("GUARD", "NOGUARD" or "HUGE").
+//     policy = SC_STACK_ARENA_NONE, SC_STACK_ARENA_GUARD,
+//              SC_STACK_ARENA_NOGUARD or SC_STACK_ARENA_HUGE.
+//------------------------------------------------------------------------------
+SC_API void sc_set_stack_arena( sc_stack_arena_policy policy )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_STACK_ARENA_AFTER_START_,"");
+        return;
+    }
+
+    switch( policy )
+    {
+      case SC_STACK_ARENA_NONE:
+          simc_p->m_stack_arena = -1;
+          break;
+      case SC_STACK_ARENA_GUARD:
+          simc_p->m_stack_arena = sc_cor_pkg::STACK_ARENA_GUARD_PAGES;
+          break;
+      case SC_STACK_ARENA_NOGUARD:
+          simc_p->m_stack_arena = 0;
+          break;
+      case SC_STACK_ARENA_HUGE:
+          simc_p->m_stack_arena = sc_cor_pkg::STACK_ARENA_HUGE_PAGES;
+          break;
+      default:
+          break;
+    }
+}
+
+SC_API sc_stack_arena_policy
+sc_get_stack_arena()
+{
+    int arena = sc_get_curr_simcontext()->m_stack_arena;
+    if ( arena < 0 )
+        return SC_STACK_ARENA_NONE;
+    if ( arena & sc_cor_pkg::STACK_ARENA_GUARD_PAGES )
+        return SC_STACK_ARENA_GUARD;
+    if ( arena & sc_cor_pkg::STACK_ARENA_HUGE_PAGES )
+        return SC_STACK_ARENA_HUGE;
+    return SC_STACK_ARENA_NOGUARD;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_lazy_clocks"
+//
+// This function sets the default of sc_clock::set_lazy() for the clocks
+// created afterwards. The default is taken from the environment variable
+// SC_LAZY_CLOCKS ("ON").
+//     enable = true to generate the edges of new clocks lazily.
+//------------------------------------------------------------------------------
+SC_API void sc_set_lazy_clocks( bool enable )
+{
+    sc_get_curr_simcontext()->m_lazy_clocks = enable;
+}
+
+SC_API bool
+sc_get_lazy_clocks()
+{
+    return sc_get_curr_simcontext()->m_lazy_clocks;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_process_profiling"
+//
+// This function enables the collection of per-process execution profiles.
+// The default is taken from the environment variable SC_PROCESS_PROFILE
+// ("ON", or the report format "TEXT", "CSV" or "JSON").
+//     enable = true to collect profiles, false to discard them.
+//     dump   = format of the report written to std::cout at sc_stop().
+//------------------------------------------------------------------------------
+SC_API void sc_set_process_profiling( bool enable,
+                                      sc_process_profile_format dump )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING(SC_ID_PROCESS_PROFILING_AFTER_START_,"");
+        return;
+    }
+    delete simc_p->m_process_profiler;
+    simc_p->m_process_profiler = enable ? new sc_process_profiler( dump ) : 0;
+}
+
+SC_API bool
+sc_get_process_profiling()
+{
+    return sc_get_curr_simcontext()->m_process_profiler != 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_write_process_profile"
+//
+// This function writes the profiles of all processes executed so far to the
+// given stream, sorted by descending host time. Nothing is written unless
+// process profiling is enabled.
+//------------------------------------------------------------------------------
+SC_API void
+sc_write_process_profile( ::std::ostream& os,
+                          sc_process_profile_format format )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( !simc_p->m_process_profiler )
+        return;
+
+    std::vector<sc_process_b*> processes;
+    for ( sc_object* obj_p = simc_p->first_object(); obj_p;
+          obj_p = simc_p->next_object() )
+    {
+        sc_process_b* process_p = dynamic_cast<sc_process_b*>( obj_p );
+        if ( process_p )
+            processes.push_back( process_p );
+    }
+    simc_p->m_process_profiler->write( os, format, processes );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_elaboration_profiling"
+//
+// This function enables the measurement of the elaboration phases, starting
+// with the construction of the modules following the call. It is ignored
+// once the callbacks of the elaboration have started. The default is taken
+// from the environment variable SC_ELAB_PROFILE ("ON", or the report format
+// "TEXT", "CSV" or "JSON").
+//     enable = true to measure the phases, false to discard the profile.
+//     dump   = format of the report written to std::cout after the
+//              start_of_simulation callbacks.
+//------------------------------------------------------------------------------
+SC_API void sc_set_elaboration_profiling( bool enable,
+                                          sc_process_profile_format dump )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_simulation_status != SC_ELABORATION )
+    {
+        SC_REPORT_WARNING(SC_ID_ELAB_PROFILING_AFTER_START_,"");
+        return;
+    }
+    delete simc_p->m_elab_profiler;
+    simc_p->m_elab_profiler = enable ? new sc_elab_profiler( dump ) : 0;
+}
+
+SC_API bool
+sc_get_elaboration_profiling()
+{
+    return sc_get_curr_simcontext()->m_elab_profiler != 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_write_elaboration_profile"
+//
+// This function writes the host time of the elaboration phases measured so
+// far to the given stream, both in total and per type of the modules,
+// ports, exports and primitive channels. Nothing is written unless
+// elaboration profiling is enabled.
+//------------------------------------------------------------------------------
+SC_API void
+sc_write_elaboration_profile( ::std::ostream& os,
+                              sc_process_profile_format format )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_elab_profiler )
+        simc_p->m_elab_profiler->write( os, format );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_scheduler_metrics"
+//
+// This function enables the collection of scheduler metrics, starting with
+// fresh counters. The default is taken from the environment variable
+// SC_SCHEDULER_METRICS ("ON" reports the metrics at sc_stop()).
+//     enable         = true to collect metrics, false to stop collecting.
+//     dump_period    = simulated time between reports, or SC_ZERO_TIME.
+//     report_at_stop = true to report the metrics at sc_stop().
+// The counters are reset in place, such that objects returned by
+// sc_get_scheduler_metrics() remain valid.
+//------------------------------------------------------------------------------
+SC_API void sc_set_scheduler_metrics( bool enable, const sc_time& dump_period,
+                                      bool report_at_stop )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( !enable ) {
+        simc_p->m_scheduler_metrics = 0;
+        return;
+    }
+    if ( simc_p->m_scheduler_metrics_storage )
+        simc_p->m_scheduler_metrics_storage->reset( dump_period,
+                                                    report_at_stop );
+    else
+        simc_p->m_scheduler_metrics_storage =
+          new sc_scheduler_metrics( dump_period, report_at_stop );
+    simc_p->m_scheduler_metrics = simc_p->m_scheduler_metrics_storage;
+}
+
+SC_API const sc_scheduler_metrics*
+sc_get_scheduler_metrics()
+{
+    return sc_get_curr_simcontext()->m_scheduler_metrics;
+}
+
+//------------------------------------------------------------------------------
+//"sc_fork_simulation"
+//
+// This function forks the host process to obtain a copy of the simulation,
+// which continues from the current state. Coroutine stacks are plain memory
+// of the process and are copied along with the kernel state, host threads
+// are not. Therefore, forking requires user-space coroutines, and the host
+// threads of the parallel evaluator are restarted on both sides. The copy
+// writes its trace files to separate files, which start with the contents
+// traced so far.
+//     trace_suffix = appended to the trace file names of the copy, or 0 to
+//                    use "_<process id>".
+// Result is 0 in the copy, the process id of the copy in the original, and
+// -1 if the simulation could not be forked.
+//------------------------------------------------------------------------------
+SC_API int sc_fork_simulation( const char* trace_suffix )
+{
+#if defined(_WIN32) || defined(WIN32) || defined(WIN64) \
+    || defined(SC_USE_PTHREADS)
+    SC_REPORT_ERROR( SC_ID_FORK_SIMULATION_UNAVAILABLE_, 0 );
+    return -1;
+#else
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    sc_status status = simc_p->get_status();
+    if ( status != SC_ELABORATION && status != SC_PAUSED )
+    {
+        SC_REPORT_ERROR( SC_ID_FORK_SIMULATION_NOT_PAUSED_, 0 );
+        return -1;
+    }
+    return simc_p->fork_simulation( trace_suffix );
+#endif
+}
+
+//------------------------------------------------------------------------------
+//"sc_post_kernel_task"
+//
+// This function posts a task for execution by the simulator thread in the
+// update phase of the next delta cycle (or at the first update phase after
+// the given delay). It may be called from any host thread.
+//     task_p -> task allocated with new, deleted after its execution.
+//     simc_p -> simulation context to execute the task, or 0 for the
+//               current simulation context of the calling host thread.
+// A host thread without a current simulation context would create an empty
+// one via sc_get_curr_simcontext(), which never executes the task, so the
+// task is discarded with an error instead.
+//------------------------------------------------------------------------------
+SC_API void sc_post_kernel_task( sc_kernel_task* task_p, sc_simcontext* simc_p )
+{
+    sc_assert( task_p != 0 );
+    if ( !simc_p )
+    {
+        simc_p = sc_curr_simcontext;
+        if ( !simc_p )
+        {
+            delete task_p;
+            SC_REPORT_ERROR( SC_ID_KERNEL_TASK_WITHOUT_CONTEXT_, "\n        "
+                "pass the simulation context when posting from a host thread" );
+            return;
+        }
+    }
+    simc_p->get_prim_channel_registry()->async_post( *task_p );
+}
+
 SC_API bool sc_is_unwinding()
 {
     return sc_get_current_process_handle().is_unwinding();
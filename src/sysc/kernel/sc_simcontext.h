@@ -31,6 +31,7 @@
 #define SC_SIMCONTEXT_H
 
 #include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/kernel/sc_elab_profile.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_status.h"
 #include "sysc/kernel/sc_time.h"
@@ -65,6 +66,13 @@ class sc_process_table;
 class sc_signal_bool_deval;
 class sc_trace_file;
 class sc_runnable;
+class sc_parallel_evaluator;
+class sc_offload_pool;
+class sc_stack_profiler;
+class sc_process_profiler;
+class sc_elab_profiler;
+class sc_scheduler_metrics;
+class sc_timed_queue;
 class sc_process_host;
 class sc_method_process;
 class sc_cthread_process;
@@ -91,6 +99,64 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// parallel evaluation of parallel-safe method processes:
+//     threads = number of host threads to use, 0 or 1 disables it.
+extern SC_API void sc_set_parallel_evaluation( unsigned threads );
+extern SC_API unsigned sc_get_parallel_evaluation();
+
+enum sc_timed_queue_policy { // queues of pending timed notifications:
+    SC_TIMED_QUEUE_HEAP,     // binary heap (default)
+    SC_TIMED_QUEUE_WHEEL     // hierarchical timing wheel
+};
+extern SC_API void sc_set_timed_queue_policy( sc_timed_queue_policy policy );
+extern SC_API sc_timed_queue_policy sc_get_timed_queue_policy();
+
+// fast teardown: at the end of simulation, the trace files and the report
+// log are closed and the lists of child objects are emptied; objects
+// destroyed afterwards skip their removal from the object hierarchy and
+// the registries of the kernel.
+extern SC_API void sc_set_fast_teardown( bool enable );
+extern SC_API bool sc_get_fast_teardown();
+
+// direct port access: once bound, sc_in, sc_inout and sc_out ports read
+// plain signals from their storage and write them without virtual calls.
+extern SC_API void sc_set_direct_port_access( bool enable );
+extern SC_API bool sc_get_direct_port_access();
+
+// stack profiling of thread processes (QuickThreads only):
+//     file = profile of the stack sizes by process name, read now and
+//            rewritten at the end of the simulation, or 0 to report the
+//            high-water marks to std::cout instead.
+extern SC_API void sc_set_stack_profiling( bool enable, const char* file = 0 );
+extern SC_API bool sc_get_stack_profiling();
+
+enum sc_stack_arena_policy { // stacks of the threads known at the end of
+                             // elaboration (QuickThreads only):
+    SC_STACK_ARENA_NONE,     // a mapping per stack (default)
+    SC_STACK_ARENA_GUARD,    // one reservation, a guard page per stack
+    SC_STACK_ARENA_NOGUARD,  // a single mapping without guard pages
+    SC_STACK_ARENA_HUGE      // as NOGUARD, on transparent huge pages
+};
+extern SC_API void sc_set_stack_arena( sc_stack_arena_policy policy );
+extern SC_API sc_stack_arena_policy sc_get_stack_arena();
+
+// lazy clocks: the default of sc_clock::set_lazy() for new clocks.
+extern SC_API void sc_set_lazy_clocks( bool enable );
+extern SC_API bool sc_get_lazy_clocks();
+
+// fork a copy of the simulation before or between sc_start() calls:
+//     trace_suffix = appended to the trace file names of the copy,
+//                    default "_<process id>".
+// Returns 0 in the copy, its process id in the original and -1 on failure.
+extern SC_API int sc_fork_simulation( const char* trace_suffix = 0 );
+
+// select the current simulation context of the calling host thread, 0 to
+// return to the default context.  Returns the previously selected context.
+// Contexts are created with "new sc_simcontext" and deleted by the caller,
+// after deselecting them.  Running several contexts concurrently on
+// different host threads requires SC_ENABLE_THREAD_LOCAL_CONTEXTS.
+extern SC_API sc_simcontext* sc_set_curr_simcontext( sc_simcontext* context );
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -156,6 +222,7 @@ class SC_API sc_simcontext
     friend class sc_process_b;
     friend class sc_process_handle;
     friend class sc_prim_channel;
+    friend class sc_parallel_evaluator;
     friend class sc_cthread_process;
     friend class sc_thread_process;
     friend SC_API sc_dt::uint64 sc_delta_count();
@@ -172,6 +239,35 @@ class SC_API sc_simcontext
     friend SC_API sc_time sc_time_to_pending_activity( const sc_simcontext* );
     friend SC_API bool sc_pending_activity_at_current_time( const sc_simcontext* );
     friend SC_API bool sc_pending_activity_at_future_time( const sc_simcontext* );
+    friend SC_API void sc_set_parallel_evaluation( unsigned );
+    friend SC_API unsigned sc_get_parallel_evaluation();
+    friend SC_API void sc_set_timed_queue_policy( sc_timed_queue_policy );
+    friend SC_API sc_timed_queue_policy sc_get_timed_queue_policy();
+    friend SC_API void sc_set_fast_teardown( bool );
+    friend SC_API bool sc_get_fast_teardown();
+    friend SC_API void sc_set_direct_port_access( bool );
+    friend SC_API bool sc_get_direct_port_access();
+    friend SC_API void sc_set_stack_profiling( bool, const char* );
+    friend SC_API bool sc_get_stack_profiling();
+    friend SC_API void sc_set_stack_arena( sc_stack_arena_policy );
+    friend SC_API sc_stack_arena_policy sc_get_stack_arena();
+    friend SC_API void sc_set_lazy_clocks( bool );
+    friend SC_API bool sc_get_lazy_clocks();
+    friend SC_API int sc_fork_simulation( const char* );
+    friend SC_API void sc_set_offload_threads( unsigned );
+    friend SC_API unsigned sc_get_offload_threads();
+    friend SC_API void sc_set_process_profiling( bool,
+                                                 sc_process_profile_format );
+    friend SC_API bool sc_get_process_profiling();
+    friend SC_API void sc_write_process_profile( ::std::ostream&,
+                                                 sc_process_profile_format );
+    friend SC_API void sc_set_elaboration_profiling( bool,
+                                                     sc_process_profile_format );
+    friend SC_API bool sc_get_elaboration_profiling();
+    friend SC_API void sc_write_elaboration_profile( ::std::ostream&,
+                                                     sc_process_profile_format );
+    friend SC_API void sc_set_scheduler_metrics( bool, const sc_time&, bool );
+    friend SC_API const sc_scheduler_metrics* sc_get_scheduler_metrics();
 
     enum sc_signal_write_check
     {
@@ -218,6 +314,16 @@ public:
     sc_port_registry* get_port_registry();
     sc_export_registry* get_export_registry();
     sc_prim_channel_registry* get_prim_channel_registry();
+    sc_offload_pool* get_offload_pool();
+    sc_stack_profiler* get_stack_profiler()
+        { return m_stack_profiler; }
+    sc_elab_profiler* get_elab_profiler()
+        { return m_elab_profiler; }
+    // write the stack profile, unless already written at sc_stop()
+    void write_stack_profile();
+    // are destroyed objects released without unregistering them?
+    bool in_fast_teardown() const
+        { return m_fast_teardown && m_end_of_simulation_called; }
 
     std::string construct_hierarchical_name(const sc_object* parent,
                                             const std::string& name);
@@ -271,8 +377,11 @@ public:
     sc_dt::uint64 change_stamp() const;
     sc_dt::uint64 delta_count() const;
     sc_dt::uint64 delta_count_at_current_time() const;
+    int pending_timed_events() const;
+    sc_dt::uint64 cancelled_timed_events() const;
     bool event_occurred( sc_dt::uint64 last_change_count ) const;
     bool evaluation_phase() const;
+    bool parallel_phase() const;
     bool is_running() const;
     bool update_phase() const;
     bool notify_phase() const;
@@ -301,10 +410,15 @@ private:
     void remove_child_object( sc_object* );
 
     void crunch( bool once=false );
+    bool crunch_parallel( sc_method_handle );
+    sc_curr_proc_handle parallel_curr_proc_info() const;
+    int fork_simulation( const char* trace_suffix );
 
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
     void add_timed_event( sc_event_timed* );
+    void remove_timed_event( sc_event_timed* );
+    void set_timed_queue_policy( sc_timed_queue_policy );
 
     void trace_cycle( bool delta_cycle );
 
@@ -367,7 +481,10 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    sc_timed_queue*             m_timed_events;
+    sc_timed_queue_policy       m_timed_queue_policy;
+    std::vector<sc_event_timed*> m_timed_events_now; // current timestep.
+    sc_dt::uint64               m_timed_events_cancelled;
 
     std::vector<sc_trace_file*> m_trace_files;
     bool                        m_something_to_trace;
@@ -375,6 +492,23 @@ private:
     sc_runnable*                m_runnable;
     sc_process_list*            m_collectable;
 
+    unsigned                    m_parallel_threads;   // # of host threads.
+    sc_parallel_evaluator*      m_parallel_evaluator; // parallel methods.
+    bool                        m_parallel_phase;     // executing in parallel.
+
+    unsigned                    m_offload_threads;    // # of host threads.
+    sc_offload_pool*            m_offload_pool;       // sc_offload() jobs.
+
+    sc_process_profiler*        m_process_profiler;   // profiling, if enabled.
+    sc_elab_profiler*           m_elab_profiler;      // profiling, if enabled.
+    sc_scheduler_metrics*       m_scheduler_metrics;  // metrics, if enabled.
+    sc_scheduler_metrics*       m_scheduler_metrics_storage; // owned metrics.
+    sc_stack_profiler*          m_stack_profiler;     // stack profiling.
+    int                         m_stack_arena;        // arena options or -1.
+    bool                        m_lazy_clocks;        // default of sc_clock.
+    bool                        m_fast_teardown;      // after end of sim.
+    bool                        m_direct_ports;       // port shortcuts.
+
     sc_time_params*             m_time_params;
     sc_time                     m_curr_time;
     mutable sc_time             m_max_time;
@@ -408,11 +542,12 @@ private:
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
-// Not MT safe.
+// Not MT safe, unless SC_ENABLE_THREAD_LOCAL_CONTEXTS is defined.  Then,
+// each host thread has its own current (and default) simulation context.
 
 #if 1
-extern SC_API sc_simcontext* sc_curr_simcontext;
-extern SC_API sc_simcontext* sc_default_global_context;
+extern SC_API SC_CONTEXT_LOCAL_ sc_simcontext* sc_curr_simcontext;
+extern SC_API SC_CONTEXT_LOCAL_ sc_simcontext* sc_default_global_context;
 
 inline sc_simcontext*
 sc_get_curr_simcontext()
@@ -503,6 +638,8 @@ inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+    if( SC_UNLIKELY_( m_parallel_phase ) )
+        return parallel_curr_proc_info();
     return &m_curr_proc_info;
 }
 
@@ -562,6 +699,14 @@ sc_simcontext::evaluation_phase() const
            m_ready_to_simulate;
 }
 
+// executing parallel-safe method processes on several host threads
+inline
+bool
+sc_simcontext::parallel_phase() const
+{
+    return m_parallel_phase;
+}
+
 inline
 bool
 sc_simcontext::update_phase() const
@@ -600,18 +745,13 @@ sc_simcontext::add_delta_event( sc_event* e )
     return static_cast<int>( m_delta_events.size() - 1 );
 }
 
-inline
-void
-sc_simcontext::add_timed_event( sc_event_timed* et )
-{
-    m_timed_events->insert( et );
-}
-
 // ----------------------------------------------------------------------------
 
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+    if( SC_UNLIKELY_( m_parallel_phase ) && write_check() )
+        return parallel_curr_proc_info()->process_handle;
     return m_current_writer;
 }
 
@@ -33,6 +33,7 @@
 #define SC_SIMCONTEXT_INT_H
 
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_process_profiler.h"
 #include "sysc/kernel/sc_runnable.h"
 #include "sysc/kernel/sc_runnable_int.h"
 
@@ -90,6 +91,8 @@ sc_simcontext::set_curr_proc( sc_process_b* process_h )
     m_curr_proc_info.kind           = process_h->proc_kind();
     m_current_writer =
       (m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_) ? process_h : 0;
+    if( SC_UNLIKELY_( m_process_profiler != 0 ) )
+        m_process_profiler->switch_to( process_h );
 }
 
 inline
@@ -100,6 +103,8 @@ sc_simcontext::reset_curr_proc()
     m_curr_proc_info.kind           = SC_NO_PROC_;
     m_current_writer                = 0;
     sc_process_b::m_last_created_process_p = 0;
+    if( SC_UNLIKELY_( m_process_profiler != 0 ) )
+        m_process_profiler->switch_to( 0 );
 }
 
 inline
@@ -0,0 +1,173 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profiler.cpp -- Stack high-water marks and stack-size profiles
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_stack_profiler.h"
+#include "sysc/kernel/sc_cor.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_thread_process.h"
+#include "sysc/utils/sc_report.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace sc_core {
+
+sc_stack_profiler::sc_stack_profiler( const std::string& file )
+  : m_file( file ), m_profile(), m_records(), m_written( false )
+{
+    if( !m_file.empty() )
+        read();
+}
+
+std::size_t
+sc_stack_profiler::min_size()
+{
+    // a guard page, a page of alignment slack and two usable pages
+    return 4 * sc_cor_pagesize();
+}
+
+std::size_t
+sc_stack_profiler::recommended_size( std::size_t used )
+{
+    // 50% headroom plus a guard page and a page of slack, page-aligned
+    const std::size_t pagesize = sc_cor_pagesize();
+    std::size_t size = used + used / 2 + 2 * pagesize;
+    size = ( size + pagesize - 1 ) / pagesize * pagesize;
+    return ( size < min_size() ) ? min_size() : size;
+}
+
+std::size_t
+sc_stack_profiler::stack_size( const char* name, std::size_t size ) const
+{
+    size_map::const_iterator it = m_profile.find( name );
+    return ( it != m_profile.end() ) ? it->second : size;
+}
+
+void
+sc_stack_profiler::retire( const sc_thread_process* thread_p )
+{
+    if( thread_p->m_cor_p == 0 )
+        return;
+
+    std::size_t used = thread_p->m_cor_p->stack_usage();
+    if( used == 0 ) // not measured by the coroutine package
+        return;
+
+    record& r = m_records[ thread_p->name() ];
+    if( used > r.used ) {
+        r.size = thread_p->m_stack_size;
+        r.used = used;
+    }
+}
+
+void
+sc_stack_profiler::write( const std::vector<sc_thread_process*>& threads )
+{
+    for( std::size_t i = 0; i < threads.size(); ++i )
+        retire( threads[i] );
+    m_written = true;
+
+    if( m_file.empty() ) {
+        write_report( ::std::cout );
+        return;
+    }
+
+    std::ofstream os( m_file.c_str() );
+    if( !os ) {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_FILE_, m_file.c_str() );
+        return;
+    }
+    write_profile( os );
+}
+
+void
+sc_stack_profiler::read()
+{
+    std::ifstream is( m_file.c_str() );
+    if( !is ) // no profile yet
+        return;
+
+    std::string line;
+    while( std::getline( is, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+
+        std::istringstream fields( line );
+        std::string name;
+        std::size_t size = 0;
+        if( !( fields >> name >> size ) || size == 0 ) {
+            SC_REPORT_WARNING( SC_ID_STACK_PROFILE_FILE_,
+                               ( m_file + ": malformed line: " + line ).c_str() );
+            continue;
+        }
+        m_profile[name] = ( size < min_size() ) ? min_size() : size;
+    }
+}
+
+void
+sc_stack_profiler::write_report( ::std::ostream& os ) const
+{
+    os << "Stack profile (" << m_records.size() << " thread processes)\n"
+       << ::std::setw(14) << "size [bytes]"
+       << ::std::setw(14) << "used [bytes]"
+       << ::std::setw(14) << "recommended"
+       << "  process\n";
+    for( record_map::const_iterator it = m_records.begin();
+         it != m_records.end(); ++it )
+    {
+        os << ::std::setw(14) << it->second.size
+           << ::std::setw(14) << it->second.used
+           << ::std::setw(14) << recommended_size( it->second.used )
+           << "  " << it->first << '\n';
+    }
+}
+
+void
+sc_stack_profiler::write_profile( ::std::ostream& os ) const
+{
+    os << "# SystemC stack profile, see SC_STACK_PROFILE\n"
+       << "# process stack_size high_water_mark\n";
+
+    // keep the entries of processes not executed in this run
+    for( size_map::const_iterator it = m_profile.begin();
+         it != m_profile.end(); ++it )
+    {
+        if( m_records.find( it->first ) == m_records.end() )
+            os << it->first << ' ' << it->second << '\n';
+    }
+    for( record_map::const_iterator it = m_records.begin();
+         it != m_records.end(); ++it )
+    {
+        os << it->first << ' ' << recommended_size( it->second.used )
+           << ' ' << it->second.used << '\n';
+    }
+}
+
+} // namespace sc_core
+
+// Taf!
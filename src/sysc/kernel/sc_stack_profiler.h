@@ -0,0 +1,119 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profiler.h -- Stack high-water marks and stack-size profiles
+
+  While stack profiling is enabled (sc_set_stack_profiling() or environment
+  variable SC_STACK_PROFILE), the coroutine package fills each new stack
+  with a known pattern.  The part of the pattern overwritten by a thread
+  process when it is deleted or at the end of the simulation yields its
+  high-water mark.
+
+  With SC_STACK_PROFILE=REPORT, the high-water marks are written to the
+  standard output.  Any other value names a profile file, which assigns a
+  stack size to thread processes by name.  The file is read at the start of
+  the simulation, if it exists, and rewritten with sizes derived from the
+  measured high-water marks at its end: at sc_stop() or, if the simulation
+  is not stopped explicitly, when the simulation context is destroyed.
+  Sizes in the file below min_size() (four pages) are raised to it.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_STACK_PROFILER_H_INCLUDED_
+#define SC_STACK_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_thread_process;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_profiler
+//
+//  Collects the stack high-water marks of thread processes.
+// ----------------------------------------------------------------------------
+
+class sc_stack_profiler
+{
+public:
+
+    // file = profile file, or empty to report to the standard output
+    explicit sc_stack_profiler( const std::string& file );
+
+    // stack size of a thread process from the profile, or the given size
+    std::size_t stack_size( const char* name, std::size_t size ) const;
+
+    // keep the high-water mark of a thread process (e.g., being destroyed)
+    void retire( const sc_thread_process* thread_p );
+
+    // report or write the profile, including the given existing threads
+    void write( const std::vector<sc_thread_process*>& threads );
+
+    // has the profile been written?
+    bool written() const
+      { return m_written; }
+
+    // stack size derived from a high-water mark
+    static std::size_t recommended_size( std::size_t used );
+
+    // smallest stack size taken from a profile
+    static std::size_t min_size();
+
+private:
+
+    struct record
+    {
+        std::size_t size; // allocated stack size.
+        std::size_t used; // high-water mark.
+    };
+
+    typedef std::map<std::string, record>      record_map;
+    typedef std::map<std::string, std::size_t> size_map;
+
+    void read();
+    void write_report( ::std::ostream& os ) const;
+    void write_profile( ::std::ostream& os ) const;
+
+private:
+    std::string m_file;    // profile file, empty: report only.
+    size_map    m_profile; // stack sizes read from the profile.
+    record_map  m_records; // maximum high-water mark per process name.
+    bool        m_written; // write() has been called.
+
+private:
+    // disabled
+    sc_stack_profiler( const sc_stack_profiler& );
+    sc_stack_profiler& operator = ( const sc_stack_profiler& );
+};
+
+} // namespace sc_core
+
+#endif // SC_STACK_PROFILER_H_INCLUDED_
+
+// Taf!
@@ -31,9 +31,15 @@
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_stack_profiler.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/utils/sc_machine.h"
 
+#if !defined(WIN32) && !defined(_WIN32)
+#   include <unistd.h>
+#endif
+
 // DEBUGGING MACROS:
 //
 // DEBUG_MSG(NAME,P,MSG)
@@ -98,6 +104,29 @@ const int SC_DEFAULT_STACK_SIZE   = SC_DEFAULT_STACK_SIZE_;
 #undef SC_DEFAULT_STACK_SIZE_
 #undef SC_OVERRIDE_DEFAULT_STACK_SIZE
 
+//------------------------------------------------------------------------------
+//"sc_cor_pagesize"
+//
+// This function returns the page size of the host, as used by the coroutine
+// packages and the stack profiler.
+//------------------------------------------------------------------------------
+std::size_t sc_cor_pagesize()
+{
+    static std::size_t pagesize = 0;
+
+    if( pagesize == 0 ) {
+#     if defined(WIN32) || defined(_WIN32)
+        pagesize = 4096;
+#     elif defined(__ppc__)
+        pagesize = getpagesize();
+#     else
+        long size = sysconf( _SC_PAGESIZE );
+        pagesize = ( size > 0 ) ? static_cast<std::size_t>( size ) : 4096;
+#     endif
+    }
+    return pagesize;
+}
+
 //------------------------------------------------------------------------------
 //"sc_thread_cor_fn"
 //
@@ -185,6 +214,10 @@ void sc_thread_process::disable_process(
         }
     }
 
+    // EDGES SKIPPED BY A TIMEOUT ARE NOT COUNTED WHILE DISABLED:
+
+    end_clock_skip();
+
     // DON'T ALLOW CORNER CASE BY DEFAULT:
 
     if ( !sc_allow_process_control_corners )
@@ -309,6 +342,7 @@ void sc_thread_process::kill_process(sc_descendant_inclusion_info descendants )
     if ( sc_is_running() && m_has_stack )
     {
         m_throw_status = THROW_KILL;
+        end_clock_skip();
         m_wait_cycle_n = 0;
         remove_dynamic_events();
         simcontext()->preempt_with(this);
@@ -327,10 +361,15 @@ void sc_thread_process::kill_process(sc_descendant_inclusion_info descendants )
 //"sc_thread_process::prepare_for_simulation"
 //
 // This method prepares this object instance for simulation. It calls the
-// coroutine package to create the actual thread.
+// coroutine package to create the actual thread. If stack profiling is
+// enabled, the stack size is taken from the profile, if available.
 //------------------------------------------------------------------------------
 void sc_thread_process::prepare_for_simulation()
 {
+    sc_stack_profiler* profiler_p = simcontext()->get_stack_profiler();
+    if( profiler_p )
+        m_stack_size = profiler_p->stack_size( name(), m_stack_size );
+
     m_cor_p = simcontext()->cor_pkg()->create( m_stack_size,
                          sc_thread_cor_fn, this );
     m_cor_p->stack_protect( true );
@@ -403,7 +442,7 @@ sc_thread_process::sc_thread_process( const char* name_p, bool free_host,
         name_p ? name_p : sc_gen_unique_name("thread_p"),
         true, free_host, method_p, host_p, opt_p),
     m_cor_p(0), m_monitor_q(), m_stack_size(SC_DEFAULT_STACK_SIZE),
-    m_wait_cycle_n(0)
+    m_wait_cycle_n(0), m_skip_until()
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMULATION HAS STARTED:
@@ -476,6 +515,9 @@ sc_thread_process::~sc_thread_process()
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
+        sc_stack_profiler* profiler_p = simcontext()->get_stack_profiler();
+        if( profiler_p )
+            profiler_p->retire( this );
         m_cor_p->stack_protect( false );
         delete m_cor_p;
         m_cor_p = 0;
@@ -590,6 +632,7 @@ void sc_thread_process::throw_reset( bool async )
     // Set the throw type and clear any pending dynamic events:
 
     m_throw_status = async ? THROW_ASYNC_RESET : THROW_SYNC_RESET;
+    end_clock_skip();
     m_wait_cycle_n = 0;
 
     // If this is an asynchronous reset:
@@ -675,6 +718,7 @@ void sc_thread_process::throw_user( const sc_throw_it_helper& helper,
 
     if( m_has_stack )
     {
+        end_clock_skip();
         remove_dynamic_events();
         DEBUG_MSG(DEBUG_NAME,this,"throwing user exception to");
         m_throw_status = THROW_USER;
@@ -763,7 +807,7 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
         -- m_event_count;
 	if ( m_event_count == 0 )
 	{
-	    m_event_list_p->auto_delete();
+	    m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
 	    m_trigger_type = STATIC;
 	}
@@ -775,13 +819,22 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
 
       case OR_LIST:
 	m_event_list_p->remove_dynamic( this, e );
-	m_event_list_p->auto_delete();
+	m_event_list_p->auto_delete( this );
 	m_event_list_p = 0;
 	m_trigger_type = STATIC;
 	break;
 
       case TIMEOUT:
 	m_trigger_type = STATIC;
+	if ( m_skip_until != SC_ZERO_TIME ) // count the remaining clock edges
+	{
+	    m_skip_until = SC_ZERO_TIME;
+	    static_cast<const sc_clock*>(
+	      m_static_events[0]->get_parent_object() )->m_skipping--;
+	    if ( m_static_events[0]->m_lazy_edge )
+	        m_static_events[0]->wake_lazy_clock();
+	    return true;
+	}
 	break;
 
       case EVENT_TIMEOUT:
@@ -806,7 +859,7 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
 	{
             m_timed_out = true;
             m_event_list_p->remove_dynamic( this, e );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
             m_event_list_p = 0;
             m_trigger_type = STATIC;
 	}
@@ -816,7 +869,7 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
             m_timeout_event_p->cancel();
             m_timeout_event_p->reset();
 	    m_event_list_p->remove_dynamic( this, e );
-	    m_event_list_p->auto_delete();
+	    m_event_list_p->auto_delete( this );
 	    m_event_list_p = 0;
 	    m_trigger_type = STATIC;
 	}
@@ -827,7 +880,7 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
 	{
             m_timed_out = true;
             m_event_list_p->remove_dynamic( this, e );
-            m_event_list_p->auto_delete();
+            m_event_list_p->auto_delete( this );
             m_event_list_p = 0;
             m_trigger_type = STATIC;
 	}
@@ -840,7 +893,7 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
 		m_timeout_event_p->cancel();
 		m_timeout_event_p->reset();
 		// no need to remove_dynamic
-		m_event_list_p->auto_delete();
+		m_event_list_p->auto_delete( this );
 		m_event_list_p = 0;
 		m_trigger_type = STATIC;
 	    }
@@ -875,6 +928,73 @@ bool sc_thread_process::trigger_dynamic( sc_event* e )
 }
 
 
+//------------------------------------------------------------------------------
+//"sc_thread_process::skip_clock_cycles"
+//
+// This method replaces counting the edges of a clock during wait(n) by a
+// single timeout.  If this thread is statically sensitive to the positive
+// or negative edge of an sc_clock only, the time of the last but one edge
+// is known in advance.  The timeout expires at the beginning of that time
+// step, i.e., before the edge event is notified, so that the remaining edge
+// count of 1 makes the thread runnable upon the last edge.
+//
+// Threads with reset signals or in synchronous reset keep counting the
+// edges, since a reset is only recognized upon a static trigger.  The
+// counting is resumed as well, if the thread is reset, disabled, killed or
+// thrown an exception, see end_clock_skip().
+//------------------------------------------------------------------------------
+void sc_thread_process::skip_clock_cycles()
+{
+    if ( m_static_events.size() != 1 || !m_resets.empty() || m_sticky_reset ||
+         (m_state & ps_bit_disabled) || m_throw_status != THROW_NONE )
+        return;
+
+    const sc_event* edge_p = m_static_events[0];
+    const sc_clock* clock_p =
+        dynamic_cast<const sc_clock*>( edge_p->get_parent_object() );
+    sc_time until;
+    if ( !clock_p || !clock_p->edge_time( *edge_p, m_wait_cycle_n, until ) )
+        return;
+
+    m_skip_until = until;
+    clock_p->m_skipping++;
+    m_wait_cycle_n = 1;
+    m_timeout_event_p->notify_internal( until - simcontext()->time_stamp() );
+    m_timeout_event_p->add_dynamic( this );
+    m_trigger_type = TIMEOUT;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_thread_process::end_clock_skip"
+//
+// This method cancels the timeout of skip_clock_cycles(), if any, and adds
+// the edges, which have not yet been skipped, to the edge count.
+//------------------------------------------------------------------------------
+void sc_thread_process::end_clock_skip()
+{
+    if ( m_skip_until == SC_ZERO_TIME )
+        return;
+
+    const sc_event* edge_p = m_static_events[0];
+    const sc_clock* clock_p =
+        dynamic_cast<const sc_clock*>( edge_p->get_parent_object() );
+    sc_time next;
+    clock_p->edge_time( *edge_p, 1, next );
+    if ( next <= m_skip_until )
+    {
+        m_wait_cycle_n += static_cast<int>(
+          ( m_skip_until - next ).value() / clock_p->period().value() ) + 1;
+    }
+
+    m_skip_until = SC_ZERO_TIME;
+    clock_p->m_skipping--;
+    m_timeout_event_p->remove_dynamic( this );
+    m_timeout_event_p->cancel();
+    m_trigger_type = STATIC;
+}
+
+
 //------------------------------------------------------------------------------
 //"sc_set_stack_size"
 //
@@ -96,6 +96,7 @@ SC_API void wait( const sc_time&, const sc_event_and_list&, sc_simcontext* );
 class sc_thread_process : public sc_process_b {
     friend void sc_thread_cor_fn( void* );
     friend void sc_set_stack_size( sc_thread_handle, std::size_t );
+    friend class sc_clock;
     friend class sc_event;
     friend class sc_join;
     friend class sc_module;
@@ -104,6 +105,7 @@ class sc_thread_process : public sc_process_b {
     friend class sc_process_table;
     friend class sc_simcontext;
     friend class sc_runnable;
+    friend class sc_stack_profiler;
     friend sc_cor* get_cor_pointer( sc_process_b* process_p );
 
     friend void wait( int, sc_simcontext* );
@@ -143,6 +145,7 @@ class sc_thread_process : public sc_process_b {
 
     void set_stack_size( std::size_t size );
     inline void suspend_me();
+    inline void suspend_to_wait();
     virtual void suspend_process(
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     virtual void throw_reset( bool async );
@@ -150,7 +153,7 @@ class sc_thread_process : public sc_process_b {
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
 
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline void trigger_static( sc_process_b* curr_p );
 
     void wait( const sc_event& );
     void wait( const sc_event_or_list& );
@@ -161,6 +164,9 @@ class sc_thread_process : public sc_process_b {
     void wait( const sc_time&, const sc_event_and_list& );
     void wait_cycles( int n=1 );
 
+    void skip_clock_cycles();
+    void end_clock_skip();
+
   protected:
     void add_monitor( sc_process_monitor* monitor_p );
     void remove_monitor( sc_process_monitor* monitor_p);
@@ -171,6 +177,7 @@ class sc_thread_process : public sc_process_b {
     std::vector<sc_process_monitor*> m_monitor_q;    // Thread monitors.
     std::size_t                      m_stack_size;   // Thread stack size.
     int                              m_wait_cycle_n; // # of waits to be done.
+    sc_time                          m_skip_until;   // end of skipped cycles.
 
   private: // disabled
     sc_thread_process( const sc_thread_process& );
@@ -266,6 +273,20 @@ inline void sc_thread_process::suspend_me()
     }
 }
 
+//------------------------------------------------------------------------------
+//"sc_thread_process::suspend_to_wait"
+//
+// This method suspends this object instance within a wait() call, which is
+// counted here while process profiling is enabled.  Other suspensions (e.g.,
+// suspend() or a synchronous reset) are not counted.
+//------------------------------------------------------------------------------
+inline void sc_thread_process::suspend_to_wait()
+{
+    if( SC_UNLIKELY_( simcontext()->m_process_profiler != 0 ) )
+        m_profile.count_wait();
+    suspend_me();
+}
+
 
 //------------------------------------------------------------------------------
 //"sc_thread_process::wait"
@@ -281,7 +302,7 @@ sc_thread_process::wait( const sc_event& e )
     m_event_p = &e; // for cleanup.
     e.add_dynamic( this );
     m_trigger_type = EVENT;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -294,7 +315,7 @@ sc_thread_process::wait( const sc_event_or_list& el )
     el.add_dynamic( this );
     m_event_list_p = &el;
     m_trigger_type = OR_LIST;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -308,7 +329,7 @@ sc_thread_process::wait( const sc_event_and_list& el )
     m_event_list_p = &el;
     m_event_count = el.size();
     m_trigger_type = AND_LIST;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -321,7 +342,7 @@ sc_thread_process::wait( const sc_time& t )
     m_timeout_event_p->notify_internal( t );
     m_timeout_event_p->add_dynamic( this );
     m_trigger_type = TIMEOUT;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -336,7 +357,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event& e )
     e.add_dynamic( this );
     m_event_p = &e;
     m_trigger_type = EVENT_TIMEOUT;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -351,7 +372,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event_or_list& el )
     el.add_dynamic( this );
     m_event_list_p = &el;
     m_trigger_type = OR_LIST_TIMEOUT;
-    suspend_me();
+    suspend_to_wait();
 }
 
 inline
@@ -367,7 +388,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event_and_list& el )
     m_event_list_p = &el;
     m_event_count = el.size();
     m_trigger_type = AND_LIST_TIMEOUT;
-    suspend_me();
+    suspend_to_wait();
 }
 
 //------------------------------------------------------------------------------
@@ -377,7 +398,9 @@ sc_thread_process::wait( const sc_time& t, const sc_event_and_list& el )
 // A cycle is defined as the event the thread is set up to staticly wait on.
 // The field m_wait_cycle_n is set to one less than the number of cycles to
 // be waited for, since the value is tested before being decremented in
-// the simulation kernel.
+// the simulation kernel.  If the cycles are the edges of a clock, the
+// edges up to the last but one are skipped by a single timeout, see
+// skip_clock_cycles().
 //------------------------------------------------------------------------------
 inline
 void
@@ -390,7 +413,9 @@ sc_thread_process::wait_cycles( int n )
         SC_REPORT_ERROR( SC_ID_WAIT_NEGATIVE_CYCLES_, name() );
 
     m_wait_cycle_n = n-1;
-    suspend_me();
+    if( m_wait_cycle_n > 1 )
+        skip_clock_cycles();
+    suspend_to_wait();
 }
 
 //------------------------------------------------------------------------------
@@ -461,13 +486,13 @@ inline sc_cor* get_cor_pointer( sc_process_b* process_p )
 //       dynamic event waits take priority.
 //   (4) The process' static wait count is zero.
 //
-// If the triggering process is the same process, the trigger is
+// If the triggering process (curr_p) is the same process, the trigger is
 // ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 // is defined.
 //------------------------------------------------------------------------------
 inline
 void
-sc_thread_process::trigger_static()
+sc_thread_process::trigger_static( sc_process_b* curr_p )
 {
     // No need to try queueing this thread if one of the following is true:
     //    (a) it is disabled
@@ -480,7 +505,7 @@ sc_thread_process::trigger_static()
         return;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
-    if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
+    if( SC_UNLIKELY_( curr_p == this ) )
     {
         report_immediate_self_notification();
         return;
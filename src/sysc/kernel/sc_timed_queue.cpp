@@ -0,0 +1,342 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_queue.cpp -- Queues of pending timed event notifications
+
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_timed_queue.h"
+
+namespace sc_core {
+
+// index of the least/most significant set bit (value must not be zero)
+
+static inline unsigned
+sc_lsb64( sc_dt::uint64 v )
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>( __builtin_ctzll( v ) );
+#else
+    unsigned i = 0;
+    while( !( v & 1 ) ) { v >>= 1; ++i; }
+    return i;
+#endif
+}
+
+static inline unsigned
+sc_msb64( sc_dt::uint64 v )
+{
+#if defined(__GNUC__)
+    return 63u - static_cast<unsigned>( __builtin_clzll( v ) );
+#else
+    unsigned i = 0;
+    while( v >>= 1 ) { ++i; }
+    return i;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_heap
+//
+//  Timed notification queue based on a binary heap.
+// ----------------------------------------------------------------------------
+
+sc_timed_heap::sc_timed_heap()
+  : m_heap()
+{
+    m_heap.reserve( 128 + 1 );
+    m_heap.push_back( 0 );
+}
+
+// move an entry towards the root, starting at position i
+
+void
+sc_timed_heap::sift_up( int i, sc_event_timed* et )
+{
+    while( (i > 1) && (notify_time( et ) < notify_time( m_heap[i >> 1] )) ) {
+        set( i, m_heap[i >> 1] );
+        i >>= 1;
+    }
+    set( i, et );
+}
+
+// move the entry at position i towards the leaves
+
+void
+sc_timed_heap::heapify( int i )
+{
+    int n = size();
+    int l;
+    while( l = i << 1, l <= n ) {
+        int earliest =
+          ( notify_time( m_heap[l] ) < notify_time( m_heap[i] ) ) ? l : i;
+
+        int r = l + 1;
+        if( (r <= n) &&
+            (notify_time( m_heap[r] ) < notify_time( m_heap[earliest] )) ) {
+            earliest = r;
+        }
+
+        if( earliest == i ) {
+            break;
+        }
+        sc_event_timed* tmp = m_heap[i];
+        set( i, m_heap[earliest] );
+        set( earliest, tmp );
+        i = earliest;
+    }
+}
+
+void
+sc_timed_heap::insert( sc_event_timed* et )
+{
+    m_heap.push_back( et );
+    sift_up( size(), et );
+}
+
+sc_event_timed*
+sc_timed_heap::top()
+{
+    sc_assert( size() > 0 );
+    return m_heap[1];
+}
+
+sc_event_timed*
+sc_timed_heap::extract_top()
+{
+    sc_assert( size() > 0 );
+    sc_event_timed* et = m_heap[1];
+    sc_event_timed* last = m_heap.back();
+    m_heap.pop_back();
+    if( size() > 0 ) {
+        set( 1, last );
+        heapify( 1 );
+    }
+    queue_index( et ) = -1;
+    return et;
+}
+
+void
+sc_timed_heap::extract_all( batch_type& batch )
+{
+    const sc_time t = notify_time( top() );
+    do {
+        batch.push_back( extract_top() );
+    } while( size() && notify_time( m_heap[1] ) == t );
+}
+
+void
+sc_timed_heap::remove( sc_event_timed* et )
+{
+    int i = queue_index( et );
+    sc_assert( i > 0 && i <= size() && m_heap[i] == et );
+
+    sc_event_timed* last = m_heap.back();
+    m_heap.pop_back();
+    if( last != et ) {
+        if( (i > 1) && (notify_time( last ) < notify_time( m_heap[i >> 1] )) ) {
+            sift_up( i, last );
+        } else {
+            set( i, last );
+            heapify( i );
+        }
+    }
+    queue_index( et ) = -1;
+}
+
+int
+sc_timed_heap::size() const
+{
+    return static_cast<int>( m_heap.size() ) - 1;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_wheel
+//
+//  Timed notification queue based on a hierarchical timing wheel.
+// ----------------------------------------------------------------------------
+
+sc_timed_wheel::sc_timed_wheel()
+  : m_now( 0 ), m_size( 0 ), m_cascade()
+{
+    for( int l = 0; l < levels; ++l ) {
+        m_used[l] = 0;
+    }
+}
+
+// slot of an entry relative to the current wheel time
+
+sc_timed_queue::batch_type&
+sc_timed_wheel::locate( sc_event_timed* et, unsigned& level, unsigned& slot )
+{
+    sc_dt::uint64 key  = notify_time( et ).value();
+    sc_dt::uint64 diff = key ^ m_now;
+    level = diff ? sc_msb64( diff ) / bits : 0;
+    slot  = static_cast<unsigned>( key >> ( level * bits ) ) & ( slots - 1 );
+    return m_slots[level][slot];
+}
+
+// store an entry relative to the current wheel time
+
+void
+sc_timed_wheel::place( sc_event_timed* et )
+{
+    unsigned level, slot;
+    batch_type& entries = locate( et, level, slot );
+
+    queue_index( et ) = static_cast<int>( entries.size() );
+    entries.push_back( et );
+    m_used[level] |= sc_dt::uint64(1) << slot;
+}
+
+// move the wheel time backwards (e.g., after peeking ahead of a pause),
+// by redistributing all entries
+
+void
+sc_timed_wheel::rebase( sc_dt::uint64 now )
+{
+    for( int l = 0; l < levels; ++l )
+    {
+        while( m_used[l] )
+        {
+            unsigned slot = sc_lsb64( m_used[l] );
+            batch_type& entries = m_slots[l][slot];
+            m_cascade.insert( m_cascade.end(), entries.begin(), entries.end() );
+            entries.clear();
+            m_used[l] &= ~( sc_dt::uint64(1) << slot );
+        }
+    }
+    m_now = now;
+    for( std::size_t i = 0; i < m_cascade.size(); ++i ) {
+        place( m_cascade[i] );
+    }
+    m_cascade.clear();
+}
+
+// cascade higher levels until level 0 holds the earliest entries,
+// returns the level 0 slot of the earliest entries
+
+unsigned
+sc_timed_wheel::advance()
+{
+    sc_assert( m_size > 0 );
+    while( !m_used[0] )
+    {
+        int level = 1;
+        while( !m_used[level] ) {
+            ++level;
+        }
+        unsigned slot  = sc_lsb64( m_used[level] );
+        unsigned shift = level * bits;
+
+        // wheel time becomes the start of the slot
+
+        sc_dt::uint64 high = ( shift + bits < 64 )
+                           ? m_now & ( ~sc_dt::uint64(0) << ( shift + bits ) )
+                           : 0;
+        m_now = high | ( sc_dt::uint64(slot) << shift );
+
+        m_cascade.swap( m_slots[level][slot] );
+        m_used[level] &= ~( sc_dt::uint64(1) << slot );
+        for( std::size_t i = 0; i < m_cascade.size(); ++i ) {
+            place( m_cascade[i] );
+        }
+        m_cascade.clear();
+    }
+    return sc_lsb64( m_used[0] );
+}
+
+void
+sc_timed_wheel::insert( sc_event_timed* et )
+{
+    if( notify_time( et ).value() < m_now ) {
+        rebase( notify_time( et ).value() );
+    }
+    place( et );
+    m_size++;
+}
+
+sc_event_timed*
+sc_timed_wheel::top()
+{
+    return m_slots[0][advance()].back();
+}
+
+sc_event_timed*
+sc_timed_wheel::extract_top()
+{
+    unsigned slot = advance();
+    batch_type& entries = m_slots[0][slot];
+    sc_event_timed* et = entries.back();
+    entries.pop_back();
+    if( entries.empty() ) {
+        m_used[0] &= ~( sc_dt::uint64(1) << slot );
+    }
+    queue_index( et ) = -1;
+    m_size--;
+    return et;
+}
+
+void
+sc_timed_wheel::extract_all( batch_type& batch )
+{
+    unsigned slot = advance();
+    batch_type& entries = m_slots[0][slot];
+    for( std::size_t i = 0; i < entries.size(); ++i ) {
+        queue_index( entries[i] ) = -1;
+    }
+    batch.insert( batch.end(), entries.begin(), entries.end() );
+    m_size -= static_cast<int>( entries.size() );
+    entries.clear();
+    m_used[0] &= ~( sc_dt::uint64(1) << slot );
+}
+
+void
+sc_timed_wheel::remove( sc_event_timed* et )
+{
+    unsigned level, slot;
+    batch_type& entries = locate( et, level, slot );
+    int i = queue_index( et );
+    sc_assert( i >= 0 && i < static_cast<int>( entries.size() )
+               && entries[i] == et );
+
+    // fill the gap with the last entry of the slot
+
+    sc_event_timed* last = entries.back();
+    entries[i] = last;
+    queue_index( last ) = i;
+    entries.pop_back();
+    if( entries.empty() ) {
+        m_used[level] &= ~( sc_dt::uint64(1) << slot );
+    }
+    queue_index( et ) = -1;
+    m_size--;
+}
+
+int
+sc_timed_wheel::size() const
+{
+    return m_size;
+}
+
+} // namespace sc_core
+
+// Taf!
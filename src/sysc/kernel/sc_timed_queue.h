@@ -0,0 +1,172 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timed_queue.h -- Queues of pending timed event notifications
+
+  The simulation context stores its timed notifications in one of the
+  following queue implementations (see sc_set_timed_queue_policy()):
+
+    - sc_timed_heap:  indexed binary heap, O(log n) insert, extraction
+                      and removal
+    - sc_timed_wheel: hierarchical timing wheel keyed on sc_time::value(),
+                      O(1) insert and removal, amortized O(1) extraction
+
+  Each entry records its position within the queue, such that cancelled
+  notifications are removed immediately instead of being left behind.
+
+  FOR INTERNAL USE ONLY!
+
+ *****************************************************************************/
+
+#ifndef SC_TIMED_QUEUE_H_INCLUDED_
+#define SC_TIMED_QUEUE_H_INCLUDED_
+
+#include "sysc/kernel/sc_event.h"
+
+#include <vector>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_queue
+//
+//  Abstract base class of all timed notification queues.
+// ----------------------------------------------------------------------------
+
+class sc_timed_queue
+{
+public:
+
+    typedef std::vector<sc_event_timed*> batch_type;
+
+    virtual ~sc_timed_queue() {}
+
+    virtual void insert( sc_event_timed* ) = 0;
+
+    // entry with the earliest notification time (queue must not be empty)
+    virtual sc_event_timed* top() = 0;
+    virtual sc_event_timed* extract_top() = 0;
+
+    // append all entries with the earliest notification time to the batch,
+    // extracted entries have a negative queue index
+    virtual void extract_all( batch_type& ) = 0;
+
+    // remove a (not yet extracted) entry from the queue
+    virtual void remove( sc_event_timed* ) = 0;
+
+    virtual int size() const = 0;
+
+protected:
+
+    static const sc_time& notify_time( const sc_event_timed* et )
+        { return et->notify_time(); }
+
+    static int& queue_index( sc_event_timed* et )
+        { return et->m_queue_index; }
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_heap
+//
+//  Timed notification queue based on a binary heap.
+// ----------------------------------------------------------------------------
+
+class sc_timed_heap : public sc_timed_queue
+{
+public:
+
+    sc_timed_heap();
+
+    virtual void insert( sc_event_timed* );
+    virtual sc_event_timed* top();
+    virtual sc_event_timed* extract_top();
+    virtual void extract_all( batch_type& );
+    virtual void remove( sc_event_timed* );
+    virtual int size() const;
+
+private:
+
+    void set( int i, sc_event_timed* et )
+        { m_heap[i] = et; queue_index( et ) = i; }
+
+    void sift_up( int i, sc_event_timed* et );
+    void heapify( int i );
+
+private:
+
+    batch_type m_heap; // 1-based binary heap, m_heap[0] is unused.
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timed_wheel
+//
+//  Timed notification queue based on a hierarchical timing wheel.
+//
+//  Each level covers 6 bits of the 64-bit notification time.  An entry is
+//  stored at the level of the most significant digit in which its time
+//  differs from the current wheel time, in the slot given by its digit at
+//  that level.  Thus, all entries of a slot at level 0 share the same time.
+//  Slots of higher levels are cascaded to lower levels on demand.
+// ----------------------------------------------------------------------------
+
+class sc_timed_wheel : public sc_timed_queue
+{
+public:
+
+    sc_timed_wheel();
+
+    virtual void insert( sc_event_timed* );
+    virtual sc_event_timed* top();
+    virtual sc_event_timed* extract_top();
+    virtual void extract_all( batch_type& );
+    virtual void remove( sc_event_timed* );
+    virtual int size() const;
+
+private:
+
+    enum
+    {
+        bits   = 6,
+        slots  = 1 << bits,
+        levels = ( 64 + bits - 1 ) / bits
+    };
+
+    batch_type& locate( sc_event_timed*, unsigned& level, unsigned& slot );
+    void place( sc_event_timed* );
+    void rebase( sc_dt::uint64 now );
+    unsigned advance();
+
+private:
+
+    sc_dt::uint64 m_now;                  // current wheel time.
+    int           m_size;                 // # of entries in the wheel.
+    sc_dt::uint64 m_used[levels];         // non-empty slots per level.
+    batch_type    m_slots[levels][slots]; // entries per slot.
+    batch_type    m_cascade;              // entries being redistributed.
+};
+
+} // namespace sc_core
+
+#endif // SC_TIMED_QUEUE_H_INCLUDED_
+
+// Taf!
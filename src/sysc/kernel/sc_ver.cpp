@@ -153,12 +153,14 @@ pln()
 
 // const int DEBUG_SYSTEMC_CHECK_           = 1;
 const int SC_DISABLE_VIRTUAL_BIND_CHECK_ = 1;
+const int SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_ = 1;
 
 template<>
 SC_API SC_API_VERSION_STRING
 <
 //   & DEBUG_SYSTEMC_CHECK_,
-  & SC_DISABLE_VIRTUAL_BIND_CHECK_
+  & SC_DISABLE_VIRTUAL_BIND_CHECK_,
+  & SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_
 >
 ::SC_API_VERSION_STRING
 (
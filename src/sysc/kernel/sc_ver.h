@@ -139,6 +139,16 @@ extern const int DEBUG_SYSTEMC_CHECK_;
 #endif
 extern const int SC_DISABLE_VIRTUAL_BIND_CHECK_;
 
+// SC_ENABLE_THREAD_LOCAL_CONTEXTS
+#if defined( SC_ENABLE_THREAD_LOCAL_CONTEXTS )
+# define SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_ \
+    SC_API_DEFINED_(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+#else
+# define SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_ \
+    SC_API_UNDEFINED_(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+#endif
+extern const int SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_;
+
 // Some preprocessor switches need to be consistent between different
 // translation units of an application.  Those can't be easily checked
 // during link-time.  Instead, perform a check during run-time by
@@ -150,7 +160,8 @@ extern const int SC_DISABLE_VIRTUAL_BIND_CHECK_;
 template // use pointers for more verbose error messages
 <
 //  const int * DebugSystemC,
-  const int * DisableVirtualBind
+  const int * DisableVirtualBind,
+  const int * EnableThreadLocalContexts
 >
 struct SC_API_VERSION_STRING
 {
@@ -176,7 +187,8 @@ struct SC_API_VERSION_STRING
 // import explicitly instantiated template
 SC_TPLEXTERN_ template struct SC_API SC_API_VERSION_STRING
 <
-  &SC_DISABLE_VIRTUAL_BIND_CHECK_
+  &SC_DISABLE_VIRTUAL_BIND_CHECK_,
+  &SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_
 >;
 
 #if !defined(SC_DISABLE_API_VERSION_CHECK)
@@ -184,7 +196,8 @@ static
 SC_API_VERSION_STRING
 <
 //  & DEBUG_SYSTEMC_CHECK_,
-  & SC_DISABLE_VIRTUAL_BIND_CHECK_
+  & SC_DISABLE_VIRTUAL_BIND_CHECK_,
+  & SC_ENABLE_THREAD_LOCAL_CONTEXTS_CHECK_
 >
 api_version_check
 (
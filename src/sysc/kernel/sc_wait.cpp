@@ -267,11 +267,23 @@ wait( const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc )
 }
 
 
+// parallel-safe method processes shall not change their sensitivity
+
+static void reject_parallel_next_trigger()
+{
+    SC_REPORT_ERROR( SC_ID_PARALLEL_SAFE_VIOLATION_,
+		     "next_trigger() ignored" );
+}
+
 // static sensitivity for SC_METHODs
 
 SC_API void
 next_trigger( sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->clear_trigger();
@@ -287,6 +299,10 @@ next_trigger( sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event& e, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( e );
@@ -299,6 +315,10 @@ next_trigger( const sc_event& e, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -317,6 +337,10 @@ next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -335,6 +359,10 @@ next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t );
@@ -347,6 +375,10 @@ next_trigger( const sc_time& t, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
 	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, e );
@@ -359,6 +391,10 @@ next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 SC_API void
 next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -377,6 +413,10 @@ next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 SC_API void
 next_trigger(const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc)
 {
+    if( SC_UNLIKELY_( simc->parallel_phase() ) ) {
+	reject_parallel_next_trigger();
+	return;
+    }
     if( el.empty() ) {
         SC_REPORT_ERROR( SC_ID_EVENT_LIST_FAILED_,
                          "next_trigger() on empty event list not allowed" );
@@ -68,7 +68,7 @@ sc_trace_file::sc_trace_file()
 
 void SC_API tprintf(sc_trace_file* tf,  const char* format, ...)
 {
-    static char buffer[4096];
+    static SC_CONTEXT_LOCAL_ char buffer[4096];
     va_list ap;
     va_start(ap, format);
     (void) vsprintf(buffer, format, ap);
@@ -165,6 +165,18 @@ protected:
     // Write trace info for cycle
     virtual void cycle( bool delta_cycle ) = 0;
 
+    // Hooks for sc_fork_simulation(): flush the file before the fork and
+    // continue tracing to a separate file in the forked simulation
+    virtual void before_fork()
+	{ /* Intentionally blank */ }
+    virtual void after_fork( const std::string& /* suffix */ )
+	{ /* Intentionally blank */ }
+
+    // Hook for sc_set_fast_teardown(): complete and close the file at the
+    // end of simulation, nothing is traced afterwards
+    virtual void before_teardown()
+	{ /* Intentionally blank */ }
+
     // Helper for event tracing
     const sc_dt::uint64& event_trigger_stamp( const sc_event& event ) const;
 
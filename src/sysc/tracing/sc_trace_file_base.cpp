@@ -73,6 +73,7 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
   , filename_()
   , initialized_(false)
   , trace_delta_cycles_(false)
+  , fork_pos_(0)
 {
     if( !name || !*name ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, "no name given" );
@@ -88,9 +89,9 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
     sc_object::detach();
     // register regular (non-delta) callbacks
     sc_object::register_simulation_phase_callback( SC_BEFORE_TIMESTEP );
-#else // explicitly register with simcontext
-    sc_get_curr_simcontext()->add_trace_file( this );
 #endif
+    // register with simcontext (for explicit trace cycles and forking)
+    sc_get_curr_simcontext()->add_trace_file( this );
 }
 
 sc_trace_file_base::~sc_trace_file_base()
@@ -101,10 +102,8 @@ sc_trace_file_base::~sc_trace_file_base()
     if( fp )
         fclose(fp);
 
-#if SC_TRACING_PHASE_CALLBACKS_ == 0
     // unregister from simcontext
     sc_get_curr_simcontext()->remove_trace_file( this );
-#endif
 }
 
 /*****************************************************************************/
@@ -120,6 +119,10 @@ sc_trace_file_base::~sc_trace_file_base()
 void
 sc_trace_file_base::simulation_phase_callback()
 {
+    // nothing is traced after closing the file in a fast teardown
+    if( is_initialized() && !fp )
+        return;
+
     // delta cycle is traced at the end of an update phase
     cycle( simcontext()->get_status() == SC_END_OF_UPDATE );
 }
@@ -185,6 +188,66 @@ sc_trace_file_base::open_fp()
     }
 }
 
+void
+sc_trace_file_base::before_fork()
+{
+    if( fp ) {
+        fflush( fp );
+        fork_pos_ = ftell( fp );
+    }
+}
+
+void
+sc_trace_file_base::before_teardown()
+{
+    if( fp ) {
+        fclose( fp );
+        fp = 0;
+    }
+}
+
+void
+sc_trace_file_base::after_fork( const std::string& suffix )
+{
+    // insert the suffix before the extension
+    std::string::size_type dot = filename_.rfind( '.' );
+    std::string name = filename_.substr( 0, dot ) + suffix
+                     + filename_.substr( dot );
+
+    if( !fp ) { // not opened yet, just use the new name
+        name.swap( filename_ );
+        return;
+    }
+
+    // copy the contents traced before the fork, the file descriptor is
+    // shared with the original simulation and must not be written to
+
+    FILE* orig_fp = fopen( filename(), "r" );
+    FILE* copy_fp = fopen( name.c_str(), "w" );
+    if( !orig_fp || !copy_fp ) {
+        if( orig_fp ) fclose( orig_fp );
+        if( copy_fp ) fclose( copy_fp );
+        SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, name.c_str() );
+        return;
+    }
+
+    char buffer[4096];
+    for( long left = fork_pos_; left > 0; ) {
+        std::size_t chunk = left < long(sizeof(buffer))
+                          ? std::size_t(left) : sizeof(buffer);
+        std::size_t n = fread( buffer, 1, chunk, orig_fp );
+        if( n == 0 )
+            break;
+        fwrite( buffer, 1, n, copy_fp );
+        left -= long(n);
+    }
+    fclose( orig_fp );
+    fclose( fp );
+
+    fp = copy_fp;
+    name.swap( filename_ );
+}
+
 void
 sc_trace_file_base::delta_cycles( bool flag )
 {
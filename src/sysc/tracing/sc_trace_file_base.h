@@ -110,6 +110,13 @@ protected:
     // Flush results and close file.
     virtual ~sc_trace_file_base();
 
+    // flush before forking, and continue in a copy of the file afterwards
+    virtual void before_fork();
+    virtual void after_fork( const std::string& suffix );
+
+    // close the file ahead of a fast teardown
+    virtual void before_teardown();
+
     static sc_time::value_type unit_to_fs(sc_time_unit tu);
 
     static std::string fs_unit_to_str(sc_trace_file_base::unit_type tu);
@@ -130,6 +137,7 @@ private:
     std::string filename_;             // name of the file (for reporting)
     bool        initialized_;          // tracing started?
     bool        trace_delta_cycles_;   // also trace delta transitions?
+    long        fork_pos_;             // file size at the last fork
 
     static bool tracing_initialized_;  // shared setup of tracing implementation
 
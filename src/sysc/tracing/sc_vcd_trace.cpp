@@ -2137,7 +2137,7 @@ vcd_trace_file::obtain_name()
 vcd_trace_file::~vcd_trace_file()
 {
     unit_type now_units_high, now_units_low;
-    if (is_initialized() && get_time_stamp(now_units_high,now_units_low)) {
+    if (fp && is_initialized() && get_time_stamp(now_units_high,now_units_low)) {
         print_time_stamp(now_units_high, now_units_low);
     }
 
@@ -2147,6 +2147,16 @@ vcd_trace_file::~vcd_trace_file()
     }
 }
 
+void
+vcd_trace_file::before_teardown()
+{
+    unit_type now_units_high, now_units_low;
+    if (fp && is_initialized() && get_time_stamp(now_units_high,now_units_low)) {
+        print_time_stamp(now_units_high, now_units_low);
+    }
+    sc_trace_file_base::before_teardown();
+}
+
 
 // Functions specific to VCD tracing
 
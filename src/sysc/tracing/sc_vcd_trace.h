@@ -218,6 +218,8 @@ private:
 
     // Initialize the VCD tracing
     virtual void do_initialize();
+    // Write the final time stamp and close the file
+    virtual void before_teardown();
     void print_time_stamp(unit_type now_units_high, unit_type now_units_low) const;
     bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
 
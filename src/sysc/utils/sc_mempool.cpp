@@ -218,8 +218,13 @@ private:
 static bool
 compute_use_default_new()
 {
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+    // the pool is shared between the host threads and not thread-safe
+    return true;
+#else
     const char* e = getenv(dont_use_envstring);
     return (e != 0) && (atoi(e) != 0);
+#endif
 }
 
 sc_mempool_int::sc_mempool_int(int blksz, int npools, int incr) :
@@ -298,7 +303,8 @@ sc_mempool::release(void* p, std::size_t sz)
 {
     if (p) {
         
-        if (use_default_new || sz > (unsigned) the_mempool->max_size) {
+        if (use_default_new || the_mempool == 0 ||
+            sz > (unsigned) the_mempool->max_size) {
             ::operator delete(p);
             return;
         }
@@ -35,6 +35,7 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
@@ -174,7 +175,7 @@ const char* sc_report::get_process_name() const
 // backward compatibility with 2.0+
 //
 
-static bool warnings_are_errors = false;
+static SC_CONTEXT_LOCAL_ bool warnings_are_errors = false;
 static const char unknown_id[] = "unknown id";
 
 void sc_report_handler::report(sc_severity severity_,
@@ -183,6 +184,11 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char* file_,
 			       int         line_ )
 {
+    // reports of parallel-safe method processes are issued after the batch
+    if ( SC_UNLIKELY_( sc_parallel_evaluator::defer_report( severity_,
+                         id_, msg_, file_, line_ ) ) )
+	return;
+
     sc_msg_def * md = sc_report_handler::mdlookup(id_);
 
     if ( !md )
@@ -31,18 +31,27 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+#  include <algorithm>
+#  include <atomic>
+#  include <vector>
+#endif
 
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
 #include "sysc/utils/sc_report_handler.h"
 #include "sysc/utils/sc_report.h"
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+#  include "sysc/communication/sc_host_mutex.h"
+#endif
 
 namespace std {}
 
 namespace sc_core {
 
-int sc_report_handler::verbosity_level = SC_MEDIUM;
+SC_CONTEXT_LOCAL_ int sc_report_handler::verbosity_level = SC_MEDIUM;
 
 // not documented, but available
 const std::string sc_report_compose_message(const sc_report& rep)
@@ -178,7 +187,7 @@ sc_log_file_handle::release()
 sc_log_file_handle::operator*()
 { return log_stream;	}
 
-static sc_log_file_handle log_stream;
+static SC_CONTEXT_LOCAL_ sc_log_file_handle log_stream;
 
 
 //
@@ -263,6 +272,7 @@ sc_msg_def * sc_report_handler::mdlookup(const char * msg_type_)
     if( !msg_type_ ) // if msg_type is NULL, report unknown error
         msg_type_ = SC_ID_UNKNOWN_ERROR_;
 
+    copy_static_msg_types();
     for ( msg_def_items * item = messages; item; item = item->next )
     {
 	for ( int i = 0; i < item->count; ++i )
@@ -331,6 +341,11 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
+    // reports of parallel-safe method processes are issued after the batch
+    if ( SC_UNLIKELY_( sc_parallel_evaluator::defer_report( severity_,
+                         msg_type_, msg_, verbosity_, file_, line_ ) ) )
+	return;
+
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the specified verbosity 
@@ -359,6 +374,11 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
+    // reports of parallel-safe method processes are issued after the batch
+    if ( SC_UNLIKELY_( sc_parallel_evaluator::defer_report( severity_,
+                         msg_type_, msg_, SC_MEDIUM, file_, line_ ) ) )
+	return;
+
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the maximum verbosity
@@ -399,6 +419,7 @@ void sc_report_handler::initialize()
     sev_call_count[SC_ERROR]   = 0;
     sev_call_count[SC_FATAL]   = 0;
 
+    copy_static_msg_types();
     msg_def_items * items = messages;
 
     while ( items != &msg_terminator )
@@ -494,12 +515,15 @@ sc_msg_def * sc_report_handler::add_msg_type(const char * msg_type_)
 	return 0;
     }
     items->md->msg_type = items->md->msg_type_data;
-    add_static_msg_types(items);
     items->allocated = true;
+    items->next = messages;
+    messages = items;
 
     return items->md;
 }
 
+#if !defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+
 void sc_report_handler::add_static_msg_types(msg_def_items * items)
 {
     items->allocated = false;
@@ -507,6 +531,107 @@ void sc_report_handler::add_static_msg_types(msg_def_items * items)
     messages = items;
 }
 
+#else // SC_ENABLE_THREAD_LOCAL_CONTEXTS
+
+// The static message types are shared by all host threads, and may be added
+// while other threads simulate.  Each thread-local simulation context links
+// its own copies of them into its messages, such that the actions, limits
+// and counters of a message type are local to the context like those of the
+// severities.  The copies are not allocated, i.e., they survive release().
+
+namespace {
+
+sc_host_mutex& static_msg_types_mutex()
+{
+    static sc_host_mutex mutex;
+    return mutex;
+}
+
+std::vector<sc_report_handler::msg_def_items*>& static_msg_types()
+{
+    static std::vector<sc_report_handler::msg_def_items*> types;
+    return types;
+}
+
+std::atomic<std::size_t> static_msg_types_count( 0 );
+
+// number of static message types copied by the calling thread, and whether
+// its copies have been freed at its exit: later lookups, e.g., by static
+// destructors, copy again without freeing
+thread_local std::size_t msg_type_copies_count = 0;
+thread_local bool        msg_type_copies_freed = false;
+
+} // namespace
+
+struct sc_report_handler::msg_type_copies
+{
+    std::vector<msg_def_items*> items;
+
+    ~msg_type_copies()
+    {
+        // the thread terminates, free its messages
+        msg_def_items * item = messages;
+        messages = &msg_terminator;
+        while ( item != &msg_terminator )
+        {
+            msg_def_items * prev = item;
+            item = item->next;
+            if ( prev->allocated )
+            {
+                for ( int i = 0; i < prev->count; ++i )
+                    free(prev->md[i].msg_type_data);
+                delete [] prev->md;
+                delete prev;
+            }
+        }
+        for ( std::size_t i = 0; i < items.size(); ++i )
+        {
+            delete [] items[i]->md;
+            delete items[i];
+        }
+        msg_type_copies_count = 0;
+        msg_type_copies_freed = true;
+    }
+};
+
+void sc_report_handler::copy_static_msg_types()
+{
+    if ( msg_type_copies_count
+         == static_msg_types_count.load( std::memory_order_acquire ) )
+        return;
+
+    static thread_local msg_type_copies copies;
+
+    sc_scoped_lock lock( static_msg_types_mutex() );
+    const std::vector<msg_def_items*>& types = static_msg_types();
+    for ( ; msg_type_copies_count < types.size(); ++msg_type_copies_count )
+    {
+        const msg_def_items * orig = types[msg_type_copies_count];
+        msg_def_items * items = new msg_def_items;
+        items->md = new sc_msg_def[orig->count];
+        std::copy( orig->md, orig->md + orig->count, items->md );
+        items->count = orig->count;
+        items->allocated = false;
+        items->next = messages;
+        messages = items;
+        if ( !msg_type_copies_freed )
+            copies.items.push_back( items );
+    }
+}
+
+void sc_report_handler::add_static_msg_types(msg_def_items * items)
+{
+    items->allocated = false;
+    items->next = 0;
+
+    sc_scoped_lock lock( static_msg_types_mutex() );
+    static_msg_types().push_back( items );
+    static_msg_types_count.store( static_msg_types().size()
+                                , std::memory_order_release );
+}
+
+#endif // SC_ENABLE_THREAD_LOCAL_CONTEXTS
+
 sc_actions sc_report_handler::set_actions(sc_severity severity_,
 					  sc_actions actions_)
 {
@@ -707,6 +832,7 @@ void sc_report_handler::cache_report(const sc_report& rep)
 
 sc_msg_def * sc_report_handler::mdlookup(int id)
 {
+    copy_static_msg_types();
     for ( msg_def_items * item = messages; item; item = item->next )
     {
 	for ( int i = 0; i < item->count; ++i )
@@ -730,10 +856,10 @@ int sc_report_handler::set_verbosity_level( int level )
 // static variables
 //
 
-sc_actions sc_report_handler::suppress_mask = 0;
-sc_actions sc_report_handler::force_mask = 0;
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::suppress_mask = 0;
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::force_mask = 0;
 
-sc_actions sc_report_handler::sev_actions[SC_MAX_SEVERITY] =
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::sev_actions[SC_MAX_SEVERITY] =
 {
     /* info  */ SC_DEFAULT_INFO_ACTIONS,
     /* warn  */ SC_DEFAULT_WARNING_ACTIONS,
@@ -743,14 +869,15 @@ sc_actions sc_report_handler::sev_actions[SC_MAX_SEVERITY] =
 
 // Note that SC_FATAL has a limit of 1 by default
 
-sc_actions sc_report_handler::sev_limit[SC_MAX_SEVERITY] =
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::sev_limit[SC_MAX_SEVERITY] =
 {
     UINT_MAX, UINT_MAX, UINT_MAX, UINT_MAX
 };
-sc_actions sc_report_handler::sev_call_count[SC_MAX_SEVERITY] = { 0, 0, 0, 0 };
+SC_CONTEXT_LOCAL_ sc_actions
+sc_report_handler::sev_call_count[SC_MAX_SEVERITY] = { 0, 0, 0, 0 };
 
-sc_report* sc_report_handler::last_global_report = NULL;
-sc_actions sc_report_handler::available_actions =
+SC_CONTEXT_LOCAL_ sc_report* sc_report_handler::last_global_report = NULL;
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::available_actions =
     SC_DO_NOTHING |
     SC_THROW |
     SC_LOG |
@@ -760,16 +887,16 @@ sc_actions sc_report_handler::available_actions =
     SC_STOP |
     SC_ABORT;
 
-sc_report_handler_proc sc_report_handler::handler =
+SC_CONTEXT_LOCAL_ sc_report_handler_proc sc_report_handler::handler =
     &sc_report_handler::default_handler;
 
-char * sc_report_handler::log_file_name = 0;
+SC_CONTEXT_LOCAL_ char * sc_report_handler::log_file_name = 0;
 
-sc_report_handler::msg_def_items * sc_report_handler::messages =
-    &sc_report_handler::msg_terminator;
+SC_CONTEXT_LOCAL_ sc_report_handler::msg_def_items *
+sc_report_handler::messages = &sc_report_handler::msg_terminator;
 
 
-sc_actions sc_report_handler::catch_actions = SC_DEFAULT_CATCH_ACTIONS;
+SC_CONTEXT_LOCAL_ sc_actions sc_report_handler::catch_actions = SC_DEFAULT_CATCH_ACTIONS;
 
 sc_actions sc_report_handler::set_catch_actions(sc_actions act)
 {
@@ -806,7 +933,7 @@ SC_API const char SC_ID_ABORT_[]              = "simulation aborted";
 	n                                                                    \
     }
 
-static sc_msg_def default_msgs[] = {
+static SC_CONTEXT_LOCAL_ sc_msg_def default_msgs[] = {
     DEFINE_MSG(SC_ID_REGISTER_ID_FAILED_, 800),
     DEFINE_MSG(SC_ID_UNKNOWN_ERROR_, 0),
     DEFINE_MSG(SC_ID_WITHOUT_MESSAGE_, 1),
@@ -818,7 +945,8 @@ static sc_msg_def default_msgs[] = {
     DEFINE_MSG(SC_ID_ABORT_, 99)
 };
 
-sc_report_handler::msg_def_items sc_report_handler::msg_terminator =
+SC_CONTEXT_LOCAL_ sc_report_handler::msg_def_items
+sc_report_handler::msg_terminator =
 {
     default_msgs,
     sizeof(default_msgs)/sizeof(*default_msgs),
@@ -140,24 +140,37 @@ protected:
     static void cache_report(const sc_report&);
     static sc_actions execute(sc_msg_def*, sc_severity);
 
-    static sc_actions   suppress_mask;
-    static sc_actions   force_mask;
-    static sc_actions   sev_actions[SC_MAX_SEVERITY];
-    static unsigned     sev_limit[SC_MAX_SEVERITY];
-    static unsigned     sev_call_count[SC_MAX_SEVERITY];
-    static sc_report*   last_global_report;
-    static sc_actions   available_actions;
-    static sc_actions   catch_actions;
-    static char*        log_file_name;
-    static int          verbosity_level;
-
-    static msg_def_items*  messages;
-    static msg_def_items   msg_terminator;
-
-    static sc_report_handler_proc  handler;
+    // settings and state local to the simulation context, see
+    // SC_ENABLE_THREAD_LOCAL_CONTEXTS and copy_static_msg_types()
+    static SC_CONTEXT_LOCAL_ sc_actions   suppress_mask;
+    static SC_CONTEXT_LOCAL_ sc_actions   force_mask;
+    static SC_CONTEXT_LOCAL_ sc_actions   sev_actions[SC_MAX_SEVERITY];
+    static SC_CONTEXT_LOCAL_ unsigned     sev_limit[SC_MAX_SEVERITY];
+    static SC_CONTEXT_LOCAL_ unsigned     sev_call_count[SC_MAX_SEVERITY];
+    static SC_CONTEXT_LOCAL_ sc_report*   last_global_report;
+    static SC_CONTEXT_LOCAL_ sc_actions   available_actions;
+    static SC_CONTEXT_LOCAL_ sc_actions   catch_actions;
+    static SC_CONTEXT_LOCAL_ char*        log_file_name;
+    static SC_CONTEXT_LOCAL_ int          verbosity_level;
+
+    static SC_CONTEXT_LOCAL_ msg_def_items*  messages;
+    static SC_CONTEXT_LOCAL_ msg_def_items   msg_terminator;
+
+    static SC_CONTEXT_LOCAL_ sc_report_handler_proc  handler;
 
     static sc_msg_def* mdlookup(const char* msg_type);
 
+private:
+
+#if defined(SC_ENABLE_THREAD_LOCAL_CONTEXTS)
+    // links copies of the message types added by add_static_msg_types()
+    // into the messages of the calling thread's context
+    struct msg_type_copies;
+    static void copy_static_msg_types();
+#else
+    static void copy_static_msg_types() {} // static types linked directly
+#endif
+
 private: // backward compatibility with 2.0+
 
     friend class sc_report;
@@ -84,16 +84,19 @@ int initialize()
 {
     (void)forty_two; /* avoid unused variable warning */
 
-    sc_report_handler::add_static_msg_types(&items);
-
     // PROCESS ANY ENVIRONMENTAL OVERRIDES:
+    // (in the definitions themselves, as each thread-local simulation
+    //  context works on its own copy of them)
 
     const char* deprecation_warn = std::getenv("SC_DEPRECATION_WARNINGS");
     if ( (deprecation_warn!=0) && !std::strcmp(deprecation_warn,"DISABLE") )
     {
-        sc_report_handler::set_actions( SC_ID_IEEE_1666_DEPRECATION_
-                                      , SC_DO_NOTHING);
+        for ( int i = 0; i < items.count; ++i )
+            if ( texts[i].msg_type == SC_ID_IEEE_1666_DEPRECATION_ )
+                texts[i].actions = SC_DO_NOTHING;
     }
+
+    sc_report_handler::add_static_msg_types(&items);
     return 42;
 }
 